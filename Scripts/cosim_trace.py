@@ -0,0 +1,208 @@
+# =========================================================================
+#
+#  File Name:         cosim_trace.py
+#  Design Unit Name:
+#  Revision:          OSVVM MODELS STANDARD VERSION
+#
+#  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+#  Contributor(s):
+#     Simon Southwell      simon.southwell@gmail.com
+#
+#
+#  Description:
+#      Converter for co-simulation binary transaction trace files,
+#      recorded when OSVVM_COSIM_TRACE is set, to text, or to a socket
+#      script of GDB remote protocol memory commands for client_batch.py
+#
+#      Usage: cosim_trace.py [-h] [-s] [-n NODE] [-o OUTPUT] tracefile
+#
+#  Revision History:
+#    Date      Version    Description
+#    10/2026   ????.??    Version 2 trace records, with a 32-bit node
+#    10/2026   ????.??    Initial revision
+#
+#
+#  This file is part of OSVVM.
+#
+#  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#      https://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+#
+# =========================================================================
+
+import argparse
+import struct
+import sys
+
+# Header and record layouts, matching vtrace_hdr_t and vtrace_rec_t in code/OsvvmVTrace.h
+HDR_FMT  = '<8sIIQQ32x'
+REC_FMT  = '<QQQQIIIIII'
+MAGIC    = b'VPTRACE\0'
+VERSION  = 2
+
+# addr_bus_trans_op_t, from code/OsvvmVProc.h
+ADDR_OPS = ['NOT_DRIVEN', 'WAIT_FOR_CLOCK', 'WAIT_FOR_TRANSACTION',
+            'WAIT_FOR_WRITE_TRANSACTION', 'WAIT_FOR_READ_TRANSACTION',
+            'GET_TRANSACTION_COUNT', 'GET_WRITE_TRANSACTION_COUNT', 'GET_READ_TRANSACTION_COUNT',
+            'GET_ALERTLOG_ID', 'SET_USE_RANDOM_DELAYS', 'GET_USE_RANDOM_DELAYS',
+            'SET_DELAYCOV_ID', 'GET_DELAYCOV_ID', 'SET_BURST_MODE', 'GET_BURST_MODE',
+            'SET_MODEL_OPTIONS', 'GET_MODEL_OPTIONS', 'EXTEND_DIRECTIVE_OP', 'EXTEND_OP',
+            'INTERRUPT_RETURN', 'WRITE_OP', 'WRITE_ADDRESS', 'WRITE_DATA', 'ASYNC_WRITE',
+            'ASYNC_WRITE_ADDRESS', 'ASYNC_WRITE_DATA', 'EXTEND_WRITE_OP', 'READ_OP',
+            'READ_ADDRESS', 'READ_DATA', 'READ_CHECK', 'READ_DATA_CHECK', 'ASYNC_READ',
+            'ASYNC_READ_ADDRESS', 'ASYNC_READ_DATA', 'ASYNC_READ_DATA_CHECK', 'EXTEND_READ_OP',
+            'WRITE_AND_READ', 'ASYNC_WRITE_AND_READ', 'WRITE_BURST', 'ASYNC_WRITE_BURST',
+            'READ_BURST', 'MULTIPLE_DRIVER_DETECT']
+
+# stream_operation_t, from code/OsvvmVProc.h, where different to the address bus
+STREAM_OPS = {3  : 'GET_TRANSACTION_COUNT', 17 : 'SEND', 18 : 'SEND_ASYNC', 19 : 'SEND_BURST',
+              20 : 'SEND_BURST_ASYNC', 21 : 'EXTEND_TX_OP', 23 : 'GET', 24 : 'TRY_GET',
+              25 : 'GET_BURST', 26 : 'TRY_GET_BURST', 27 : 'CHECK', 28 : 'TRY_CHECK',
+              29 : 'CHECK_BURST', 30 : 'TRY_CHECK_BURST'}
+
+COSIM_OPS = {1024 : 'SET_TEST_NAME', 1025 : 'QUEUE_DRAIN', 1026 : 'READ_POLL'}
+
+# trans_type_e, from code/OsvvmVProc.h
+TYPES    = ['trans32_byte', 'trans32_hword', 'trans32_word', 'trans32_dword', 'trans32_qword', 'trans32_burst',
+            'trans64_byte', 'trans64_hword', 'trans64_word', 'trans64_dword', 'trans64_qword', 'trans64_burst',
+            'stream_snd_byte', 'stream_snd_hword', 'stream_snd_word', 'stream_snd_dword', 'stream_snd_qword', 'stream_snd_burst',
+            'stream_get_byte', 'stream_get_hword', 'stream_get_word', 'stream_get_dword', 'stream_get_qword', 'stream_get_burst',
+            'trans_idle']
+
+STREAM_TYPE_START = 12
+
+# Access size in bytes of the single address bus transaction types
+TYPE_BYTES = {0 : 1, 1 : 2, 2 : 4, 3 : 8, 6 : 1, 7 : 2, 8 : 4, 9 : 8}
+
+WRITE_OPS = (20, 23, 37, 38)   # WRITE_OP, ASYNC_WRITE, WRITE_AND_READ, ASYNC_WRITE_AND_READ
+READ_OPS  = (27, 30)           # READ_OP, READ_CHECK
+
+# -----------------------------------------------------------------
+# readTrace()
+#
+# Read the records of a trace file, oldest first, skipping any
+# overwritten whilst being recorded
+#
+def readTrace(fname) :
+
+  with open(fname, 'rb') as fp :
+    data = fp.read()
+
+  hdrsize = struct.calcsize(HDR_FMT)
+  recsize = struct.calcsize(REC_FMT)
+
+  magic, version, rec_size, num_recs, head = struct.unpack_from(HDR_FMT, data, 0)
+
+  if magic != MAGIC or version != VERSION or rec_size != recsize :
+    sys.exit('***Error: %s is not a version %d co-simulation trace file' % (fname, VERSION))
+
+  records = []
+  skipped = 0
+
+  for seq in range(max(0, head - num_recs), head) :
+    rec = struct.unpack_from(REC_FMT, data, hdrsize + (seq % num_recs) * recsize)
+    if rec[0] != seq :
+      skipped += 1
+    else :
+      records.append(rec)
+
+  if head > num_recs :
+    sys.stderr.write('cosim_trace: %d records overwritten in ring of %d\n' % (head - num_recs, num_recs))
+
+  if skipped :
+    sys.stderr.write('cosim_trace: skipped %d incomplete records\n' % skipped)
+
+  return records
+
+# -----------------------------------------------------------------
+# opName()
+#
+# Name of a record's operation, for its transaction type
+#
+def opName(op, rtype) :
+
+  if op in COSIM_OPS :
+    return COSIM_OPS[op]
+  elif rtype >= STREAM_TYPE_START and rtype < len(TYPES) - 1 and op in STREAM_OPS :
+    return STREAM_OPS[op]
+  elif op < len(ADDR_OPS) :
+    return ADDR_OPS[op]
+  else :
+    return 'OP_%d' % op
+
+# -----------------------------------------------------------------
+# textLine()
+#
+# Format a record as a line of text
+#
+def textLine(rec) :
+
+  seq, addr, wdata, rdata, burst, ticks, irq, op, rtype, node = rec
+
+  tname = TYPES[rtype] if rtype < len(TYPES) else 'type_%d' % rtype
+
+  return '%10d node=%-2d %-26s %-16s addr=%016x wdata=%016x rdata=%016x burst=%-5d ticks=%-5d irq=%08x' % \
+         (seq, node, opName(op, rtype), tname, addr, wdata, rdata, burst, ticks, irq)
+
+# -----------------------------------------------------------------
+# sktLine()
+#
+# Format a single address bus write or read record as a GDB remote
+# protocol memory command, or None if not a memory access
+#
+def sktLine(rec) :
+
+  seq, addr, wdata, rdata, burst, ticks, irq, op, rtype, node = rec
+
+  if rtype not in TYPE_BYTES :
+    return None
+
+  nbytes = TYPE_BYTES[rtype]
+  mask   = (1 << (nbytes * 8)) - 1
+
+  if op in WRITE_OPS :
+    return 'M%08x,%d:%0*x' % (addr, nbytes, nbytes * 2, wdata & mask)
+  elif op in READ_OPS :
+    return 'm%08x,%d' % (addr, nbytes)
+  else :
+    return None
+
+# -----------------------------------------------------------------
+# main()
+#
+def main() :
+
+  parser = argparse.ArgumentParser(description='Convert a co-simulation binary trace file')
+  parser.add_argument('tracefile',             help='trace file recorded with OSVVM_COSIM_TRACE set')
+  parser.add_argument('-s', '--skt',           action='store_true', help='output a socket script of memory commands')
+  parser.add_argument('-n', '--node',          type=int, default=None, help='only output records of node NODE')
+  parser.add_argument('-o', '--output',        default=None, help='output file (default stdout)')
+  args = parser.parse_args()
+
+  out = open(args.output, 'w') if args.output else sys.stdout
+
+  for rec in readTrace(args.tracefile) :
+
+    if args.node is not None and rec[9] != args.node :
+      continue
+
+    line = sktLine(rec) if args.skt else textLine(rec)
+
+    if line is not None :
+      out.write(line + '\n')
+
+  if args.output :
+    out.close()
+
+if __name__ == '__main__' :
+  main()
@@ -15,6 +15,12 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   ????.??    Added irqWait and irqWake
+//    10/2026   ????.??    No unused prot argument on transReadPollMask
+//    10/2026   ????.??    Added transaction queue, batch, read future, perfDump,
+//                         read cache and transReadPollMask methods, with read
+//                         polling executed by the simulator, scatter-gather
+//                         burst overloads and interrupt event queue methods
 //    09/2025   ????.??    Added support for Set- & Get- burst mode and model options
 //    05/2023   2023.05    Adding asynchronous transaction support
 //    03/2023   2023.04    Adding basic stream support
@@ -46,6 +52,22 @@
 #ifndef __OSVVM_COSIM_H_
 #define __OSVVM_COSIM_H_
 
+// Handle for a read issued with transReadFuture, whose data is returned
+// when available without further message exchanges, or waited for.
+class OsvvmCosimReadFuture
+{
+public:
+                OsvvmCosimReadFuture (const uint32_t idIn = 0, const int nodeIn = 0) : id(idIn), node(nodeIn) {};
+
+      bool     ready           (void)                                                                                  {return VReadFutureReady(id, node);}
+      uint64_t wait            (void)                                                                                  {return VReadFutureWait(id, node);}
+      uint32_t getId           (void)                                                                                  {return id;}
+
+private:
+      uint32_t id;
+      int      node;
+};
+
 class OsvvmCosim
 {
 public:
@@ -148,31 +170,54 @@ public:
       void     transReadCheck                (uint64_t addr, uint64_t  data, const int prot = 0)                 {VTransUserCommon(READ_CHECK, &addr, data, &dummyStatus, prot, node);}
 
 
-      void     transReadPoll                 (uint32_t addr, uint8_t  *data, const int idx, const int bitval, const int waittime = 10, const int prot = 0)
-                                                 {do {tick(waittime); transRead(addr, data, prot);} while((*data & (1 << idx)) != ((bitval & 1) << idx));}
+      void     transReadPoll                 (uint32_t addr, uint8_t  *data, const int idx, const int bitval, const int waittime = 10, const int /*prot*/ = 0)
+                                                 {readPoll(addr, 32, data, 1ULL << idx, (uint64_t)(bitval & 1) << idx, waittime, 0, NULL);}
+
+      void     transReadPoll                 (uint32_t addr, uint16_t *data, const int idx, const int bitval, const int waittime = 10, const int /*prot*/ = 0)
+                                                 {readPoll(addr, 32, data, 1ULL << idx, (uint64_t)(bitval & 1) << idx, waittime, 0, NULL);}
+
+      void     transReadPoll                 (uint32_t addr, uint32_t *data, const int idx, const int bitval, const int waittime = 10, const int /*prot*/ = 0)
+                                                 {readPoll(addr, 32, data, 1ULL << idx, (uint64_t)(bitval & 1) << idx, waittime, 0, NULL);}
+
+      void     transReadPoll                 (uint64_t addr, uint8_t  *data, const int idx, const int bitval, const int waittime = 10, const int /*prot*/ = 0)
+                                                 {readPoll(addr, 64, data, 1ULL << idx, (uint64_t)(bitval & 1) << idx, waittime, 0, NULL);}
+
+      void     transReadPoll                 (uint64_t addr, uint16_t *data, const int idx, const int bitval, const int waittime = 10, const int /*prot*/ = 0)
+                                                 {readPoll(addr, 64, data, 1ULL << idx, (uint64_t)(bitval & 1) << idx, waittime, 0, NULL);}
+
+      void     transReadPoll                 (uint64_t addr, uint32_t *data, const int idx, const int bitval, const int waittime = 10, const int /*prot*/ = 0)
+                                                 {readPoll(addr, 64, data, 1ULL << idx, (uint64_t)(bitval & 1) << idx, waittime, 0, NULL);}
+
+      void     transReadPoll                 (uint64_t addr, uint64_t *data, const int idx, const int bitval, const int waittime = 10, const int /*prot*/ = 0)
+                                                 {readPoll(addr, 64, data, 1ULL << idx, (uint64_t)(bitval & 1) << idx, waittime, 0, NULL);}
 
-      void     transReadPoll                 (uint32_t addr, uint16_t *data, const int idx, const int bitval, const int waittime = 10, const int prot = 0)
-                                                 {do {tick(waittime); transRead(addr, data, prot);} while((*data & (1 << idx)) != ((bitval & 1) << idx));}
+      bool     transReadPollMask             (uint32_t addr, uint8_t  *data, const uint64_t mask, const uint64_t expval, const int interval = 10, const int timeout = 0, int *iterations = NULL)
+                                                 {return readPoll(addr, 32, data, mask, expval, interval, timeout, iterations);}
 
-      void     transReadPoll                 (uint32_t addr, uint32_t *data, const int idx, const int bitval, const int waittime = 10, const int prot = 0)
-                                                 {do {tick(waittime); transRead(addr, data, prot);} while((*data & (1 << idx)) != ((bitval & 1) << idx));}
+      bool     transReadPollMask             (uint32_t addr, uint16_t *data, const uint64_t mask, const uint64_t expval, const int interval = 10, const int timeout = 0, int *iterations = NULL)
+                                                 {return readPoll(addr, 32, data, mask, expval, interval, timeout, iterations);}
 
-      void     transReadPoll                 (uint64_t addr, uint8_t  *data, const int idx, const int bitval, const int waittime = 10, const int prot = 0)
-                                                 {do {tick(waittime); transRead(addr, data, prot);} while((*data & (1 << idx)) != ((bitval & 1) << idx));}
+      bool     transReadPollMask             (uint32_t addr, uint32_t *data, const uint64_t mask, const uint64_t expval, const int interval = 10, const int timeout = 0, int *iterations = NULL)
+                                                 {return readPoll(addr, 32, data, mask, expval, interval, timeout, iterations);}
 
-      void     transReadPoll                 (uint64_t addr, uint16_t *data, const int idx, const int bitval, const int waittime = 10, const int prot = 0)
-                                                 {do {tick(waittime); transRead(addr, data, prot);} while((*data & (1 << idx)) != ((bitval & 1) << idx));}
+      bool     transReadPollMask             (uint64_t addr, uint8_t  *data, const uint64_t mask, const uint64_t expval, const int interval = 10, const int timeout = 0, int *iterations = NULL)
+                                                 {return readPoll(addr, 64, data, mask, expval, interval, timeout, iterations);}
 
-      void     transReadPoll                 (uint64_t addr, uint32_t *data, const int idx, const int bitval, const int waittime = 10, const int prot = 0)
-                                                 {do {tick(waittime); transRead(addr, data, prot);} while((*data & (1 << idx)) != ((bitval & 1) << idx));}
+      bool     transReadPollMask             (uint64_t addr, uint16_t *data, const uint64_t mask, const uint64_t expval, const int interval = 10, const int timeout = 0, int *iterations = NULL)
+                                                 {return readPoll(addr, 64, data, mask, expval, interval, timeout, iterations);}
 
-      void     transReadPoll                 (uint64_t addr, uint64_t *data, const int idx, const int bitval, const int waittime = 10, const int prot = 0)
-                                                 {do {tick(waittime); transRead(addr, data, prot);} while((*data & (1 << idx)) != ((bitval & 1) << idx));}
+      bool     transReadPollMask             (uint64_t addr, uint32_t *data, const uint64_t mask, const uint64_t expval, const int interval = 10, const int timeout = 0, int *iterations = NULL)
+                                                 {return readPoll(addr, 64, data, mask, expval, interval, timeout, iterations);}
+
+      bool     transReadPollMask             (uint64_t addr, uint64_t *data, const uint64_t mask, const uint64_t expval, const int interval = 10, const int timeout = 0, int *iterations = NULL)
+                                                 {return readPoll(addr, 64, data, mask, expval, interval, timeout, iterations);}
 
       void     transBurstWrite               (const uint32_t addr, uint8_t  *data, const int bytesize, const int prot = 0)   {VTransBurstCommon(WRITE_BURST, BURST_NORM, addr, data, bytesize, prot, node);}
       void     transBurstWrite               (const uint64_t addr, uint8_t  *data, const int bytesize, const int prot = 0)   {VTransBurstCommon(WRITE_BURST, BURST_NORM, addr, data, bytesize, prot, node);}
       void     transBurstWrite               (const uint32_t addr, const int bytesize, const int prot = 0)                   {VTransBurstCommon(WRITE_BURST, BURST_TRANS, addr, NULL, bytesize, prot, node);}
       void     transBurstWrite               (const uint64_t addr, const int bytesize, const int prot = 0)                   {VTransBurstCommon(WRITE_BURST, BURST_TRANS, addr, NULL, bytesize, prot, node);}
+      void     transBurstWrite               (const uint32_t addr, const vburst_iov_t *iov, const int iovcnt, const int prot = 0) {VTransBurstIovCommon(WRITE_BURST, BURST_NORM, addr, iov, iovcnt, prot, node);}
+      void     transBurstWrite               (const uint64_t addr, const vburst_iov_t *iov, const int iovcnt, const int prot = 0) {VTransBurstIovCommon(WRITE_BURST, BURST_NORM, addr, iov, iovcnt, prot, node);}
       void     transBurstWriteAsync          (const uint32_t addr, uint8_t  *data, const int bytesize, const int prot = 0)   {VTransBurstCommon(ASYNC_WRITE_BURST, BURST_NORM, addr, data, bytesize, prot, node);}
       void     transBurstWriteAsync          (const uint64_t addr, uint8_t  *data, const int bytesize, const int prot = 0)   {VTransBurstCommon(ASYNC_WRITE_BURST, BURST_NORM, addr, data, bytesize, prot, node);}
 
@@ -193,6 +238,8 @@ public:
       void     transBurstRead                (const uint64_t addr, uint8_t  *data, const int bytesize, const int prot = 0)   {VTransBurstCommon(READ_BURST, BURST_NORM,  addr, data, bytesize, prot, node);}
       void     transBurstRead                (const uint32_t addr, const int bytesize, const int prot = 0)                   {VTransBurstCommon(READ_BURST, BURST_TRANS, addr, NULL, bytesize, prot, node);}
       void     transBurstRead                (const uint64_t addr, const int bytesize, const int prot = 0)                   {VTransBurstCommon(READ_BURST, BURST_TRANS, addr, NULL, bytesize, prot, node);}
+      void     transBurstRead                (const uint32_t addr, const vburst_iov_t *iov, const int iovcnt, const int prot = 0) {VTransBurstIovCommon(READ_BURST, BURST_NORM, addr, iov, iovcnt, prot, node);}
+      void     transBurstRead                (const uint64_t addr, const vburst_iov_t *iov, const int iovcnt, const int prot = 0) {VTransBurstIovCommon(READ_BURST, BURST_NORM, addr, iov, iovcnt, prot, node);}
 
       void     transBurstReadCheckIncrement  (const uint32_t addr, uint8_t   data, const int bytesize, const int prot = 0)   {VTransBurstCommon(READ_BURST, BURST_INCR, addr, &data, bytesize, prot, node);}
       void     transBurstReadCheckIncrement  (const uint64_t addr, uint8_t   data, const int bytesize, const int prot = 0)   {VTransBurstCommon(READ_BURST, BURST_INCR, addr, &data, bytesize, prot, node);}
@@ -215,10 +262,43 @@ public:
       int      transGetWriteTransactionCount (void)                                                                          {return VTransGetCount(GET_WRITE_TRANSACTION_COUNT, node);}
       int      transGetReadTransactionCount  (void)                                                                          {return VTransGetCount(GET_READ_TRANSACTION_COUNT, node);}
 
+      bool     transQueueWrite               (const uint32_t addr, const uint32_t data, const uint32_t tag = 0)              {return VQueueTrans(WRITE_OP, addr, data, 32, 32, tag, node);}
+      bool     transQueueWrite               (const uint64_t addr, const uint64_t data, const uint32_t tag = 0)              {return VQueueTrans(WRITE_OP, addr, data, 64, 64, tag, node);}
+      bool     transQueueWriteAsync          (const uint32_t addr, const uint32_t data, const uint32_t tag = 0)              {return VQueueTrans(ASYNC_WRITE, addr, data, 32, 32, tag, node);}
+      bool     transQueueWriteAsync          (const uint64_t addr, const uint64_t data, const uint32_t tag = 0)              {return VQueueTrans(ASYNC_WRITE, addr, data, 64, 64, tag, node);}
+      bool     transQueueRead                (const uint32_t addr, const uint32_t tag = 0)                                   {return VQueueTrans(READ_OP, addr, 0, 32, 32, tag, node);}
+      bool     transQueueRead                (const uint64_t addr, const uint32_t tag = 0)                                   {return VQueueTrans(READ_OP, addr, 0, 64, 64, tag, node);}
+      int      transQueueFlush               (void)                                                                          {return VQueueFlush(node);}
+      bool     transQueueGetResp             (uint32_t *tag, uint64_t *data, int *status)                                    {return VQueueGetResp(tag, data, status, node);}
+
+      OsvvmCosimReadFuture transReadFuture (const uint32_t addr, const int data_width = 32, const int prot = 0)            {return OsvvmCosimReadFuture(VReadFutureIssue(addr, 32, data_width, prot, node), node);}
+      OsvvmCosimReadFuture transReadFuture (const uint64_t addr, const int data_width = 64, const int prot = 0)            {return OsvvmCosimReadFuture(VReadFutureIssue(addr, 64, data_width, prot, node), node);}
+
+      int      transWriteBatch               (vbatch_trans_t *trans, const int num)                                          {return VTransBatch(WRITE_OP, trans, num, node);}
+      int      transReadBatch                (vbatch_trans_t *trans, const int num)                                          {return VTransBatch(READ_OP, trans, num, node);}
+
+      // Reads in cacheable ranges are served from the node's cache. Single word writes are written through.
+      bool     cacheAddRange                 (const uint64_t addr, const uint64_t size)                                      {return VCacheAddRange(addr, size, node);}
+      void     cacheClearRanges              (void)                                                                          {VCacheClearRanges(node);}
+      void     cacheInvalidate               (const uint64_t addr, const uint64_t size)                                      {VCacheInvalidate(addr, size, node);}
+      void     cacheInvalidate               (void)                                                                          {VCacheInvalidate(0, ~0ULL, node);}
+      void     cacheGetStats                 (uint64_t *hits, uint64_t *misses)                                              {VCacheGetStats(hits, misses, node);}
+
       void     regInterruptCB                (pVUserInt_t func)                                                              {VRegInterrupt(func, node);}
 
+      // Interrupt events raised by VIrqVec are drained at each transaction, or by an ISR thread calling irqDrain,
+      // or irqWait to sleep until there are events. Up to VP_IRQ_QUEUE_SIZE (default 1024) events may be undrained,
+      // with any more a fatal error, so an ISR thread must keep up, as must a node in a long READ_POLL or burst
+      int      irqDrain                      (void)                                                                          {return VIrqDrain(node);}
+      int      irqWait                       (void)                                                                          {return VIrqWait(node);}
+      void     irqWake                       (void)                                                                          {VIrqWakeWaiters(node);}
+      void     irqSetExchDrain               (const bool enable)                                                             {VIrqSetExchDrain(enable, node);}
+      uint64_t irqEventTime                  (void)                                                                          {return VIrqEventTime(node);}
+
       void     waitForSim                    (void)                                                                          {VWaitForSim(node);}
 
+      void     perfDump                      (void)                                                                          {VPerfDump(node);}
+
       int      getNodeNumber                 (void)                                                                          {return node;}
       
       void     setModelOptions               (const int option, const int optval)                                            {VSetModelOptions(option, optval, node);}
@@ -227,6 +307,29 @@ public:
       void     setBurstMode                  (const int mode)                                                                {VSetBurstMode(mode, node);}
       int      getBurstMode                  ()                                                                              {return VGetBurstMode(node);}
 
+protected:
+
+      // Read poll, with the polling loop executed by the simulator. With an interrupt
+      // callback registered, the poll is ended by an interrupt, for the callback to be
+      // run, and then continued. If interrupted is not NULL, the poll is instead
+      // returned from on an interrupt, with interrupted set.
+      template <typename T> bool readPoll (const uint64_t addr, const int addr_width, T *data, const uint64_t mask, const uint64_t expval,
+                                           const int interval, const int timeout, int *iterations, bool *interrupted = NULL)
+      {
+          uint64_t rdata;
+          int      polls;
+          bool     matched = VTransReadPoll(addr, addr_width, sizeof(T)*8, mask, expval, interval, timeout, &rdata, &polls, interrupted, node);
+
+          *data = (T)rdata;
+
+          if (iterations != NULL)
+          {
+              *iterations = polls;
+          }
+
+          return matched;
+      }
+
 private:
 
       int      dummyStatus;
@@ -16,6 +16,10 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   ????.??    No unused prot argument on transReadPollMask
+//    10/2026   ????.??    Added transReadPollMask, transReadFuture and scatter-gather
+//                         burst overloads, and event driven interrupt processing,
+//                         including during read polls
 //    05/2023   2023.05    Adding asynchronous transaction support
 //    03/2023   2023.04    Adding basic stream support
 //    01/2023   2023.01    Initial revision
@@ -56,7 +60,9 @@
 // interrupt request state.
 //
 // The interrupts granularity is at the transaction level, with interrupts
-// being processed before each transaction generating method call.
+// being processed before each transaction generating method call. Read
+// polls are ended by VIrqVec interrupts, which are processed before the
+// poll carries on.
 //
 // =========================================================================
 
@@ -75,6 +81,8 @@ public:
                {
                    int_active  = 0;
                    int_enabled = 0;
+                   int_req     = 0;
+                   int_pending = 0;
                    int_master_enable = false;
 
                    for (int idx = 0; idx < max_interrupts; idx++)
@@ -152,13 +160,24 @@ public:
       void     transRead                     (const uint64_t addr, uint32_t *data, const int prot = 0)                        {processInt(); OsvvmCosim::transRead(addr, data, prot);}
       void     transRead                     (const uint64_t addr, uint64_t *data, const int prot = 0)                        {processInt(); OsvvmCosim::transRead(addr, data, prot);}
 
-      void     transReadPoll                 (const uint32_t addr, uint8_t  *data, const int idx, const int bitval, const int waittime = 10, const int prot = 0) {processInt(); OsvvmCosim::transReadPoll(addr, data, idx, bitval, waittime, prot);}
-      void     transReadPoll                 (const uint32_t addr, uint16_t *data, const int idx, const int bitval, const int waittime = 10, const int prot = 0) {processInt(); OsvvmCosim::transReadPoll(addr, data, idx, bitval, waittime, prot);}
-      void     transReadPoll                 (const uint32_t addr, uint32_t *data, const int idx, const int bitval, const int waittime = 10, const int prot = 0) {processInt(); OsvvmCosim::transReadPoll(addr, data, idx, bitval, waittime, prot);}
-      void     transReadPoll                 (const uint64_t addr, uint8_t  *data, const int idx, const int bitval, const int waittime = 10, const int prot = 0) {processInt(); OsvvmCosim::transReadPoll(addr, data, idx, bitval, waittime, prot);}
-      void     transReadPoll                 (const uint64_t addr, uint16_t *data, const int idx, const int bitval, const int waittime = 10, const int prot = 0) {processInt(); OsvvmCosim::transReadPoll(addr, data, idx, bitval, waittime, prot);}
-      void     transReadPoll                 (const uint64_t addr, uint32_t *data, const int idx, const int bitval, const int waittime = 10, const int prot = 0) {processInt(); OsvvmCosim::transReadPoll(addr, data, idx, bitval, waittime, prot);}
-      void     transReadPoll                 (const uint64_t addr, uint64_t *data, const int idx, const int bitval, const int waittime = 10, const int prot = 0) {processInt(); OsvvmCosim::transReadPoll(addr, data, idx, bitval, waittime, prot);}
+      void     transReadPoll                 (const uint32_t addr, uint8_t  *data, const int idx, const int bitval, const int waittime = 10, const int /*prot*/ = 0) {readPollInt(addr, 32, data, 1ULL << idx, (uint64_t)(bitval & 1) << idx, waittime, 0, NULL);}
+      void     transReadPoll                 (const uint32_t addr, uint16_t *data, const int idx, const int bitval, const int waittime = 10, const int /*prot*/ = 0) {readPollInt(addr, 32, data, 1ULL << idx, (uint64_t)(bitval & 1) << idx, waittime, 0, NULL);}
+      void     transReadPoll                 (const uint32_t addr, uint32_t *data, const int idx, const int bitval, const int waittime = 10, const int /*prot*/ = 0) {readPollInt(addr, 32, data, 1ULL << idx, (uint64_t)(bitval & 1) << idx, waittime, 0, NULL);}
+      void     transReadPoll                 (const uint64_t addr, uint8_t  *data, const int idx, const int bitval, const int waittime = 10, const int /*prot*/ = 0) {readPollInt(addr, 64, data, 1ULL << idx, (uint64_t)(bitval & 1) << idx, waittime, 0, NULL);}
+      void     transReadPoll                 (const uint64_t addr, uint16_t *data, const int idx, const int bitval, const int waittime = 10, const int /*prot*/ = 0) {readPollInt(addr, 64, data, 1ULL << idx, (uint64_t)(bitval & 1) << idx, waittime, 0, NULL);}
+      void     transReadPoll                 (const uint64_t addr, uint32_t *data, const int idx, const int bitval, const int waittime = 10, const int /*prot*/ = 0) {readPollInt(addr, 64, data, 1ULL << idx, (uint64_t)(bitval & 1) << idx, waittime, 0, NULL);}
+      void     transReadPoll                 (const uint64_t addr, uint64_t *data, const int idx, const int bitval, const int waittime = 10, const int /*prot*/ = 0) {readPollInt(addr, 64, data, 1ULL << idx, (uint64_t)(bitval & 1) << idx, waittime, 0, NULL);}
+
+      bool     transReadPollMask             (const uint32_t addr, uint8_t  *data, const uint64_t mask, const uint64_t expval, const int interval = 10, const int timeout = 0, int *iterations = NULL) {return readPollInt(addr, 32, data, mask, expval, interval, timeout, iterations);}
+      bool     transReadPollMask             (const uint32_t addr, uint16_t *data, const uint64_t mask, const uint64_t expval, const int interval = 10, const int timeout = 0, int *iterations = NULL) {return readPollInt(addr, 32, data, mask, expval, interval, timeout, iterations);}
+      bool     transReadPollMask             (const uint32_t addr, uint32_t *data, const uint64_t mask, const uint64_t expval, const int interval = 10, const int timeout = 0, int *iterations = NULL) {return readPollInt(addr, 32, data, mask, expval, interval, timeout, iterations);}
+      bool     transReadPollMask             (const uint64_t addr, uint8_t  *data, const uint64_t mask, const uint64_t expval, const int interval = 10, const int timeout = 0, int *iterations = NULL) {return readPollInt(addr, 64, data, mask, expval, interval, timeout, iterations);}
+      bool     transReadPollMask             (const uint64_t addr, uint16_t *data, const uint64_t mask, const uint64_t expval, const int interval = 10, const int timeout = 0, int *iterations = NULL) {return readPollInt(addr, 64, data, mask, expval, interval, timeout, iterations);}
+      bool     transReadPollMask             (const uint64_t addr, uint32_t *data, const uint64_t mask, const uint64_t expval, const int interval = 10, const int timeout = 0, int *iterations = NULL) {return readPollInt(addr, 64, data, mask, expval, interval, timeout, iterations);}
+      bool     transReadPollMask             (const uint64_t addr, uint64_t *data, const uint64_t mask, const uint64_t expval, const int interval = 10, const int timeout = 0, int *iterations = NULL) {return readPollInt(addr, 64, data, mask, expval, interval, timeout, iterations);}
+
+      OsvvmCosimReadFuture transReadFuture   (const uint32_t addr, const int data_width = 32, const int prot = 0)             {processInt(); return OsvvmCosim::transReadFuture(addr, data_width, prot);}
+      OsvvmCosimReadFuture transReadFuture   (const uint64_t addr, const int data_width = 64, const int prot = 0)             {processInt(); return OsvvmCosim::transReadFuture(addr, data_width, prot);}
 
       void     transReadCheck                (const uint32_t addr, uint8_t   data, const int prot = 0)                        {processInt(); OsvvmCosim::transReadCheck(addr, data, prot);}
       void     transReadCheck                (const uint32_t addr, uint16_t  data, const int prot = 0)                        {processInt(); OsvvmCosim::transReadCheck(addr, data, prot);}
@@ -172,6 +191,8 @@ public:
       void     transBurstWrite               (const uint64_t addr, uint8_t  *data, const int bytesize, const int prot = 0)    {processInt(); OsvvmCosim::transBurstWrite(addr, data, bytesize, prot);}
       void     transBurstWrite               (const uint32_t addr, const int bytesize, const int prot = 0)                    {processInt(); OsvvmCosim::transBurstWrite(addr, bytesize, prot);}
       void     transBurstWrite               (const uint64_t addr, const int bytesize, const int prot = 0)                    {processInt(); OsvvmCosim::transBurstWrite(addr, bytesize, prot);}
+      void     transBurstWrite               (const uint32_t addr, const vburst_iov_t *iov, const int iovcnt, const int prot = 0) {processInt(); OsvvmCosim::transBurstWrite(addr, iov, iovcnt, prot);}
+      void     transBurstWrite               (const uint64_t addr, const vburst_iov_t *iov, const int iovcnt, const int prot = 0) {processInt(); OsvvmCosim::transBurstWrite(addr, iov, iovcnt, prot);}
       void     transBurstWriteAsync          (const uint32_t addr, uint8_t  *data, const int bytesize, const int prot = 0)    {processInt(); OsvvmCosim::transBurstWriteAsync(addr, data, bytesize, prot);}
       void     transBurstWriteAsync          (const uint64_t addr, uint8_t  *data, const int bytesize, const int prot = 0)    {processInt(); OsvvmCosim::transBurstWriteAsync(addr, data, bytesize, prot);}
 
@@ -189,6 +210,8 @@ public:
       void     transBurstRead                (const uint64_t addr, uint8_t  *data, const int bytesize, const int prot = 0)    {processInt(); OsvvmCosim::transBurstRead (addr, data, bytesize, prot);}
       void     transBurstRead                (const uint32_t addr, const int bytesize, const int prot = 0)                    {processInt(); OsvvmCosim::transBurstRead (addr, bytesize, prot);}
       void     transBurstRead                (const uint64_t addr, const int bytesize, const int prot = 0)                    {processInt(); OsvvmCosim::transBurstRead (addr, bytesize, prot);}
+      void     transBurstRead                (const uint32_t addr, const vburst_iov_t *iov, const int iovcnt, const int prot = 0) {processInt(); OsvvmCosim::transBurstRead (addr, iov, iovcnt, prot);}
+      void     transBurstRead                (const uint64_t addr, const vburst_iov_t *iov, const int iovcnt, const int prot = 0) {processInt(); OsvvmCosim::transBurstRead (addr, iov, iovcnt, prot);}
 
       void     transBurstReadCheckIncrement  (const uint32_t addr, uint8_t  data, const int bytesize, const int prot = 0)     {processInt(); OsvvmCosim::transBurstReadCheckIncrement(addr, data, bytesize, prot);}
       void     transBurstReadCheckIncrement  (const uint64_t addr, uint8_t  data, const int bytesize, const int prot = 0)     {processInt(); OsvvmCosim::transBurstReadCheckIncrement(addr, data, bytesize, prot);}
@@ -204,63 +227,115 @@ public:
       void     tick                          (const int ticks, const bool done = false, const bool error = false)             {processInt(); OsvvmCosim::tick(ticks, done, error);}
 
       // Enable/disable master interrupt
-      void enableMasterInterrupt             (void)                                                                           {int_master_enable = true;}
-      void disableMasterInterrupt            (void)                                                                           {int_master_enable = false;}
+      void enableMasterInterrupt             (void)                                                                           {int_master_enable = true;  updatePending();}
+      void disableMasterInterrupt            (void)                                                                           {int_master_enable = false; updatePending();}
 
       // Enable/disable individual interrupts
-      void enableIsr                         (const int int_num)                                                              {if (int_num < max_interrupts && isr[int_num] != NULL) {int_enabled |=  (1 << (int_num & (max_interrupts-1)));}}
-      void disableIsr                        (const int int_num)                                                              {int_enabled &= ~(1 << (int_num & (max_interrupts-1)));}
+      void enableIsr                         (const int int_num)                                                              {if (int_num < max_interrupts && isr[int_num] != NULL) {int_enabled |=  (1 << (int_num & (max_interrupts-1))); updatePending();}}
+      void disableIsr                        (const int int_num)                                                              {int_enabled &= ~(1 << (int_num & (max_interrupts-1))); updatePending();}
 
-      // Interrupt input. Call from external registered callback function
-      int  updateIntReq                      (const uint32_t intReq)                                                          {int_req = intReq; return 0;}
+      // Interrupt input. Call from external registered callback function. Any resulting
+      // interrupt state change is latched as pending, for processing before the next transaction
+      int  updateIntReq                      (const uint32_t intReq)                                                          {int_req = intReq; updatePending(); return 0;}
 
       void registerIsr                       (const pVUserInt_t isrFunc, const unsigned level)                                {if (level < max_interrupts) isr[level] = isrFunc;}
 
 protected:
-      // Process any outstanding interrupts. Will process in priority
-      // order, with 0 being the highest. The ISRs can be interrupted
-      // by higher priority interrupts.
+      // Process any outstanding interrupts, only when there is pending
+      // interrupt state to update. Will process in priority order, with 0
+      // being the highest. The ISRs can be interrupted by higher priority
+      // interrupts.
       void processInt()
       {
-          // Only process if the master interuppt enable is true
-          if (int_master_enable)
+          if (int_pending)
           {
-              // Set bits for any pending interrupts that are enabled and not active
-              // and that has the interrupt request input
-              uint32_t int_new_int = int_enabled & ~int_active & int_req;
+              serviceInt();
+          }
+      }
 
-              // Priority inspect the interrupts for servicing  (0 = highest)
-              for (int isr_idx = 0; isr_idx < max_interrupts; isr_idx++)
-              {
-                  bool higher_active = int_active & (0xffffffffULL >> (max_interrupts-isr_idx));
+private:
 
-                  // Map the index to a unary value
-                  uint32_t int_unary = 1 << isr_idx;
+      // Read poll, with the polling loop executed by the simulator, but ended by
+      // any VIrqVec interrupt or interrupt request change so that it can be
+      // processed, before polling on for the remaining number of reads
+      template <typename T> bool readPollInt (const uint64_t addr, const int addr_width, T *data, const uint64_t mask, const uint64_t expval,
+                                              const int interval, const int timeout, int *iterations)
+      {
+          int  total = 0;
+          int  polls;
+          bool matched;
+          bool interrupted;
 
-                  // If IRQ low for indexed bit when active clear active state
-                  if(int_active & ~int_req & int_unary)
-                  {
-                      // Clear the indexed ISR active bit
-                      int_active &= ~int_unary;
-                  }
+          do
+          {
+              processInt();
+
+              matched = readPoll(addr, addr_width, data, mask, expval, interval, timeout ? timeout - total : 0, &polls, &interrupted);
+              total  += polls;
+          }
+          while (!matched && interrupted && (timeout == 0 || total < timeout));
+
+          if (iterations != NULL)
+          {
+              *iterations = total;
+          }
+
+          return matched;
+      }
+
+      // Latch the interrupt state changes that processInt must make: the
+      // clearing of active interrupts whose request has gone away, and the
+      // highest priority new interrupt, if no higher priority interrupt
+      // is active. Called whenever the request, enable or active state changes.
+      void updatePending()
+      {
+          uint32_t int_new_int = int_enabled & ~int_active & int_req;
+          uint32_t int_lowest  = int_new_int & (~int_new_int + 1);
+
+          int_pending = !int_master_enable ? 0 : (int_active & ~int_req) | ((int_active & (int_lowest - 1)) ? 0 : int_lowest);
+      }
+
+      void serviceInt()
+      {
+          // Set bits for any pending interrupts that are enabled and not active
+          // and that has the interrupt request input
+          uint32_t int_new_int = int_enabled & ~int_active & int_req;
+          uint32_t done_mask   = 0;
+          uint32_t int_todo;
+
+          // Visit, in priority order (0 = highest), only the interrupts to be
+          // started or to have their active state cleared
+          while ((int_todo = (int_new_int | (int_active & ~int_req)) & ~done_mask) != 0)
+          {
+              int      isr_idx       = __builtin_ctz(int_todo);
+              uint32_t int_unary     = 1U << isr_idx;
+              bool     higher_active = int_active & (int_unary - 1);
+
+              done_mask = (int_unary << 1) - 1;
+
+              // If IRQ low for indexed bit when active clear active state
+              if (int_active & ~int_req & int_unary)
+              {
+                  int_active &= ~int_unary;
+              }
+
+              // If a new interrupt at index and no active higher priority interrupt, process it
+              if ((int_new_int & int_unary) && !higher_active)
+              {
+                  // Set the active bit for the interrupt
+                  int_active |= int_unary;
+                  updatePending();
 
-                  // If a new interrupt at index and no active higher priority interrupt, process it
-                  if ((int_new_int & int_unary) && !higher_active)
+                  // Select the ISR and call it.
+                  if (isr[isr_idx] != NULL)
                   {
-                      // Set the active bit for the interrupt
-                      int_active |= int_unary;
-
-                      // Select the ISR and call it.
-                      if (isr[isr_idx] != NULL)
-                      {
-                          (*(isr[isr_idx]))(int_req);
-                      }
+                      (*(isr[isr_idx]))(int_req);
                   }
               }
           }
-      }
 
-private:
+          updatePending();
+      }
 
       // Function pointers for ISRs
       pVUserInt_t isr[max_interrupts];
@@ -276,6 +351,9 @@ private:
 
       // Interrupts request input state
       uint32_t    int_req;
+
+      // Pending interrupt state changes, for processInt
+      uint32_t    int_pending;
 };
 
 #endif
\ No newline at end of file
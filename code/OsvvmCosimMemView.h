@@ -0,0 +1,267 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimMemView.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Simulator co-simulation C++ class giving a device memory view of
+//      an address window, built on an OsvvmCosim object. Typed loads and
+//      stores are made at offsets into the window. Consecutive stores are
+//      gathered in a write combining buffer, and written as a single
+//      transBurstWrite when the buffer fills, a store is not contiguous
+//      with those buffered, a load is made, or on a fence. A buffer with
+//      only a single store is written with a transWrite of the store's
+//      width. Loads are not combined, and fence the buffer first, so
+//      device accesses are seen in program order. Accesses outside the
+//      window are reported and skipped, with loads returning zero, and
+//      counted in getErrors().
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Signed typed loads
+//    10/2026   ????.??    Out of window accesses skipped and counted
+//    10/2026   ????.??    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "OsvvmCosim.h"
+
+#ifndef __OSVVM_COSIM_MEMVIEW_H_
+#define __OSVVM_COSIM_MEMVIEW_H_
+
+// Default write combining buffer size, in bytes
+#define MEMVIEW_DEFAULT_WC_SIZE     256
+
+class OsvvmCosimMemView
+{
+public:
+
+                OsvvmCosimMemView (OsvvmCosim &cosimIn, const uint64_t baseIn, const uint64_t sizeIn,
+                                   const bool addr64In = false, const int wcSizeIn = MEMVIEW_DEFAULT_WC_SIZE) :
+                                   cosim(cosimIn), base(baseIn), size(sizeIn), addr64(addr64In), errors(0), wc_len(0), wc_stores(0), wc_width(0)
+                {
+                    wc_size = (wcSizeIn < 1) ? 1 : (wcSizeIn > DATABUF_SIZE) ? DATABUF_SIZE : wcSizeIn;
+                };
+
+                // Any buffered stores are written when the view goes out of scope
+               ~OsvvmCosimMemView () {fence();}
+
+    // Typed store of value at offset into the window
+    template <typename T> void store (const uint64_t offset, const T value)
+    {
+        if (!checkRange(offset, sizeof(T), "store"))
+        {
+            return;
+        }
+
+        // Flush the buffer if the store is not contiguous with it, or would overflow it
+        if (wc_len && (offset != wc_offset + wc_len || wc_len + (int)sizeof(T) > wc_size))
+        {
+            fence();
+        }
+
+        if (wc_len == 0)
+        {
+            wc_offset = offset;
+        }
+
+        memcpy(&wc_buf[wc_len], &value, sizeof(T));
+
+        wc_len   += sizeof(T);
+        wc_width  = sizeof(T);
+        wc_stores++;
+
+        if (wc_len == wc_size)
+        {
+            fence();
+        }
+    }
+
+    // Typed load of a value at offset into the window, after any buffered stores are written.
+    // Read as the unsigned word of the type's width, so signed types may also be loaded.
+    template <typename T> T load (const uint64_t offset)
+    {
+        static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "load type must be 1, 2, 4 or 8 bytes");
+
+        T value = 0;
+
+        if (!checkRange(offset, sizeof(T), "load"))
+        {
+            return value;
+        }
+
+        fence();
+
+        switch(sizeof(T))
+        {
+            case 1:  value = wordAs<T, uint8_t>(offset);  break;
+            case 2:  value = wordAs<T, uint16_t>(offset); break;
+            case 4:  value = wordAs<T, uint32_t>(offset); break;
+            default: value = wordAs<T, uint64_t>(offset); break;
+        }
+
+        return value;
+    }
+
+    // Store len bytes from src at offset into the window, as a byte by byte
+    // copy would, combined into bursts
+    void write (const uint64_t offset, const void* src, const uint64_t len)
+    {
+        if (!checkRange(offset, len, "write"))
+        {
+            return;
+        }
+
+        for (uint64_t idx = 0; idx < len; idx++)
+        {
+            store<uint8_t>(offset + idx, ((const uint8_t*)src)[idx]);
+        }
+    }
+
+    // Read len bytes at offset into the window to dst, as burst reads, after
+    // any buffered stores are written
+    void read (const uint64_t offset, void* dst, const uint64_t len)
+    {
+        if (!checkRange(offset, len, "read"))
+        {
+            return;
+        }
+
+        fence();
+
+        if (addr64)
+        {
+            cosim.transBurstRead(base + offset, (uint8_t*)dst, (int)len);
+        }
+        else
+        {
+            cosim.transBurstRead((uint32_t)(base + offset), (uint8_t*)dst, (int)len);
+        }
+    }
+
+    // Write any buffered stores
+    void fence (void)
+    {
+        if (wc_len == 0)
+        {
+            return;
+        }
+
+        // A buffer with a single store is written as a single word write of its width
+        if (wc_stores == 1)
+        {
+            switch (wc_width)
+            {
+                case 1:  writeWord(wc_offset, bufWord<uint8_t>());  break;
+                case 2:  writeWord(wc_offset, bufWord<uint16_t>()); break;
+                case 4:  writeWord(wc_offset, bufWord<uint32_t>()); break;
+                default: writeWord(wc_offset, bufWord<uint64_t>()); break;
+            }
+        }
+        else if (addr64)
+        {
+            cosim.transBurstWrite(base + wc_offset, wc_buf, wc_len);
+        }
+        else
+        {
+            cosim.transBurstWrite((uint32_t)(base + wc_offset), wc_buf, wc_len);
+        }
+
+        wc_len    = 0;
+        wc_stores = 0;
+    }
+
+    uint64_t    getBase          (void) {return base;}
+    uint64_t    getSize          (void) {return size;}
+    int         getErrors        (void) {return errors;}
+
+private:
+
+    template <typename T> T bufWord (void)
+    {
+        T value;
+        memcpy(&value, wc_buf, sizeof(T));
+        return value;
+    }
+
+    // Read an unsigned word W at offset, returned as the type T
+    template <typename T, typename W> T wordAs (const uint64_t offset)
+    {
+        W word  = 0;
+        T value = 0;
+
+        readWord(offset, &word);
+        memcpy(&value, &word, sizeof(T) < sizeof(W) ? sizeof(T) : sizeof(W));
+
+        return value;
+    }
+
+    // Single word accesses at the view's address width. There are no 64-bit
+    // data transactions with 32-bit addresses, so these are made as bursts.
+    void        writeWord        (const uint64_t offset, const uint8_t  data) {if (addr64) cosim.transWrite(base + offset, data); else cosim.transWrite((uint32_t)(base + offset), data);}
+    void        writeWord        (const uint64_t offset, const uint16_t data) {if (addr64) cosim.transWrite(base + offset, data); else cosim.transWrite((uint32_t)(base + offset), data);}
+    void        writeWord        (const uint64_t offset, const uint32_t data) {if (addr64) cosim.transWrite(base + offset, data); else cosim.transWrite((uint32_t)(base + offset), data);}
+    void        writeWord        (const uint64_t offset, const uint64_t data) {if (addr64) cosim.transWrite(base + offset, data); else cosim.transBurstWrite((uint32_t)(base + offset), (uint8_t*)&data, 8);}
+
+    void        readWord         (const uint64_t offset, uint8_t  *data)      {if (addr64) cosim.transRead(base + offset, data);  else cosim.transRead((uint32_t)(base + offset), data);}
+    void        readWord         (const uint64_t offset, uint16_t *data)      {if (addr64) cosim.transRead(base + offset, data);  else cosim.transRead((uint32_t)(base + offset), data);}
+    void        readWord         (const uint64_t offset, uint32_t *data)      {if (addr64) cosim.transRead(base + offset, data);  else cosim.transRead((uint32_t)(base + offset), data);}
+    void        readWord         (const uint64_t offset, uint64_t *data)      {if (addr64) cosim.transRead(base + offset, data);  else cosim.transBurstRead((uint32_t)(base + offset), (uint8_t*)data, 8);}
+
+    // Check an access lies within the window, reporting and counting it if not
+    bool checkRange (const uint64_t offset, const uint64_t len, const char* access)
+    {
+        if (offset > size || len > size - offset)
+        {
+            VPrint("***Error: OsvvmCosimMemView %s of %llu bytes at offset 0x%llx outside window of 0x%llx bytes\n",
+                   access, (unsigned long long)len, (unsigned long long)offset, (unsigned long long)size);
+            errors++;
+            return false;
+        }
+
+        return true;
+    }
+
+    OsvvmCosim &cosim;
+
+    uint64_t    base;
+    uint64_t    size;
+    bool        addr64;
+    int         errors;
+
+    // Write combining buffer
+    uint8_t     wc_buf[DATABUF_SIZE];
+    uint64_t    wc_offset;
+    int         wc_size;
+    int         wc_len;
+    int         wc_stores;
+    int         wc_width;
+};
+
+#endif
@@ -0,0 +1,350 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimReplay.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Simulator co-simulation C++ class to replay a recorded stream of
+//      address bus transactions on a node, at the maximum rate. The
+//      trace is either a binary trace recorded with OSVVM_COSIM_TRACE
+//      set, or a socket script of GDB remote protocol memory commands
+//      (as written by the iss test to sktscript.txt). The whole trace is
+//      loaded and decoded before replay starts.
+//
+//      Reads are compared with the recorded read data of a binary trace.
+//      Socket script reads are only checked if given expected data, in
+//      the non-standard form m<addr>,<bytes>:<data>. Bursts, and wait
+//      for clock and other directive operations, are not replayed.
+//
+//      OSVVM_REPLAY_MAIN(n) defines a VUserMain<n> that replays the
+//      trace named by the OSVVM_COSIM_REPLAY environment variable.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Traced READ_CHECK replays check the expected value
+//    10/2026   ????.??    OSVVM_REPLAY_MAIN sleeps with SLEEPFOREVER
+//    10/2026   ????.??    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "OsvvmVUser.h"
+
+#ifndef __OSVVM_COSIM_REPLAY_H_
+#define __OSVVM_COSIM_REPLAY_H_
+
+// Number of read mismatches individually reported
+#define REPLAY_MAX_REPORTED     10
+
+#define REPLAY_ENV              "OSVVM_COSIM_REPLAY"
+
+// Define a VUserMain<n> entry point replaying the OSVVM_COSIM_REPLAY trace
+#define OSVVM_REPLAY_MAIN(_n)                                                \
+extern "C" void VUserMain##_n()                                              \
+{                                                                            \
+    const int node = _n;                                                     \
+    OsvvmCosimReplay replay(node, "CoSim_replay");                           \
+    const char* fname = getenv(REPLAY_ENV);                                  \
+    bool error = fname == NULL || !replay.load(fname) || replay.run() != 0;  \
+    if (fname == NULL)                                                       \
+    {                                                                        \
+        VPrint("***Error: %s not set to a trace file\n", REPLAY_ENV);        \
+    }                                                                        \
+    replay.tick(10, true, error);                                            \
+    SLEEPFOREVER;                                                            \
+}
+
+class OsvvmCosimReplay
+{
+public:
+
+    // Pre-decoded transaction
+    typedef struct
+    {
+        int         op;
+        int         bytes;
+        bool        addr64;
+        bool        check;
+        uint64_t    addr;
+        uint64_t    wdata;
+        uint64_t    rdata;
+    } replay_t;
+
+                OsvvmCosimReplay (int nodeIn = 0, std::string test_name = "") : node(nodeIn), mismatches(0), skipped(0) {
+                   if (test_name.compare(""))
+                   {
+                       VSetTestName(test_name.c_str(), test_name.length(), node);
+                   }
+                };
+
+    void        tick             (const int ticks, const bool done = false, const bool error = false)
+    {
+#ifndef DISABLE_VUSERMAIN_THREAD
+        VTick(ticks, done, error, node);
+#else
+        VTick(ticks, false, error, node);
+#endif
+    }
+
+    // Load and decode a trace file, replacing any already loaded. For a binary
+    // trace, only the transactions of trace_node are loaded, defaulting to
+    // those of this node.
+    bool        load             (const char* fname, const int trace_node = -1)
+    {
+        FILE* fp;
+        char  magic[8];
+        bool  ok;
+
+        trans.clear();
+        skipped = 0;
+
+        if ((fp = fopen(fname, "rb")) == NULL)
+        {
+            VPrint("OsvvmCosimReplay: ***Error: failed to open %s\n", fname);
+            return false;
+        }
+
+        if (fread(magic, 1, sizeof(magic), fp) == sizeof(magic) && memcmp(magic, VP_TRACE_MAGIC, sizeof(magic)) == 0)
+        {
+            ok = loadBinary(fp, trace_node < 0 ? node : trace_node);
+        }
+        else
+        {
+            rewind(fp);
+            ok = loadScript(fp);
+        }
+
+        fclose(fp);
+
+        VPrint("OsvvmCosimReplay: node %d loaded %d transactions from %s (%d not replayable)\n",
+               node, (int)trans.size(), fname, skipped);
+
+        return ok;
+    }
+
+    // Replay the loaded transactions, returning the number of read mismatches
+    int         run              (void)
+    {
+        mismatches = 0;
+
+        for (size_t idx = 0; idx < trans.size(); idx++)
+        {
+            replay_t &t    = trans[idx];
+            uint64_t  got  = replayOne(t);
+
+            if (t.check && got != t.rdata)
+            {
+                if (mismatches < REPLAY_MAX_REPORTED)
+                {
+                    VPrint("OsvvmCosimReplay: ***Error: transaction %d read 0x%llx from 0x%llx. Expected 0x%llx\n",
+                           (int)idx, (unsigned long long)got, (unsigned long long)t.addr, (unsigned long long)t.rdata);
+                }
+                mismatches++;
+            }
+        }
+
+        VPrint("OsvvmCosimReplay: node %d replayed %d transactions with %d read mismatches\n",
+               node, (int)trans.size(), mismatches);
+
+        return mismatches;
+    }
+
+    int         getNumTrans      (void) {return (int)trans.size();}
+    int         getMismatches    (void) {return mismatches;}
+    int         getSkipped       (void) {return skipped;}
+
+private:
+
+    // Replay a transaction at its address width and data size, returning any read data.
+    // There are no 64-bit data transactions with 32-bit addresses.
+    template <typename T> uint64_t replayData (const replay_t &t)
+    {
+        int status;
+
+        if (t.addr64)
+        {
+            uint64_t addr = t.addr;
+            return VTransUserCommon(t.op, &addr, (T)t.wdata, &status, 0, node);
+        }
+        else
+        {
+            uint32_t addr = (uint32_t)t.addr;
+            return VTransUserCommon(t.op, &addr, (T)t.wdata, &status, 0, node);
+        }
+    }
+
+    uint64_t    replayOne        (const replay_t &t)
+    {
+        int      status;
+        uint64_t addr = t.addr;
+
+        switch(t.bytes)
+        {
+        case 1:  return replayData<uint8_t>(t);
+        case 2:  return replayData<uint16_t>(t);
+        case 4:  return replayData<uint32_t>(t);
+        default: return VTransUserCommon(t.op, &addr, t.wdata, &status, 0, node);
+        }
+    }
+
+    // Binary trace, as recorded with OSVVM_COSIM_TRACE set (see OsvvmVTrace.h)
+    bool        loadBinary       (FILE* fp, const int trace_node)
+    {
+        uint32_t     version, rec_size;
+        uint64_t     num_recs, head;
+        vtrace_rec_t rec;
+
+        if (fread(&version,  sizeof(version),  1, fp) != 1 || fread(&rec_size, sizeof(rec_size), 1, fp) != 1 ||
+            fread(&num_recs, sizeof(num_recs), 1, fp) != 1 || fread(&head,     sizeof(head),     1, fp) != 1 ||
+            version != VP_TRACE_VERSION || rec_size != sizeof(vtrace_rec_t) || num_recs == 0)
+        {
+            VPrint("OsvvmCosimReplay: ***Error: bad binary trace header\n");
+            return false;
+        }
+
+        uint64_t first = head > num_recs ? head - num_recs : 0;
+
+        trans.reserve(head - first);
+
+        for (uint64_t seq = first; seq < head; seq++)
+        {
+            if (fseek(fp, sizeof(vtrace_hdr_t) + (seq % num_recs) * sizeof(vtrace_rec_t), SEEK_SET) != 0 ||
+                fread(&rec, sizeof(rec), 1, fp) != 1)
+            {
+                VPrint("OsvvmCosimReplay: ***Error: truncated binary trace\n");
+                return false;
+            }
+
+            if (rec.seq != seq || rec.node != (uint32_t)trace_node)
+            {
+                continue;
+            }
+
+            replay_t t;
+
+            t.addr   = rec.addr;
+            t.wdata  = rec.wdata;
+            t.rdata  = rec.rdata;
+            t.addr64 = rec.type >= trans64_byte;
+
+            switch(rec.type)
+            {
+            case trans32_byte:  case trans64_byte:  t.bytes = 1; break;
+            case trans32_hword: case trans64_hword: t.bytes = 2; break;
+            case trans32_word:  case trans64_word:  t.bytes = 4; break;
+            case trans32_dword: case trans64_dword: t.bytes = 8; break;
+            default:            t.bytes = 0;                     break;
+            }
+
+            switch(rec.op)
+            {
+            case WRITE_OP:
+            case ASYNC_WRITE:          t.op = rec.op;         t.check = false; break;
+            case READ_OP:              t.op = READ_OP;        t.check = true;  break;
+
+            // A traced READ_CHECK's send data is the expected value, and
+            // the read data whatever the model returned, so check against that
+            case READ_CHECK:           t.op = READ_OP;        t.check = true;
+                                       t.rdata = rec.wdata;                    break;
+            case WRITE_AND_READ:       t.op = WRITE_AND_READ; t.check = true;  break;
+            default:                   t.bytes = 0;                            break;
+            }
+
+            if (t.bytes == 0)
+            {
+                // Only count the transactions not replayed, and not directives
+                if (rec.op >= WRITE_OP && rec.op < SET_TEST_NAME)
+                {
+                    skipped++;
+                }
+                continue;
+            }
+
+            if (t.bytes < 8)
+            {
+                t.rdata &= (1ULL << (t.bytes * 8)) - 1;
+            }
+
+            trans.push_back(t);
+        }
+
+        return true;
+    }
+
+    // Socket script of GDB memory commands, one per line
+    bool        loadScript       (FILE* fp)
+    {
+        char line[256];
+        int  lineno = 0;
+
+        while (fgets(line, sizeof(line), fp) != NULL)
+        {
+            unsigned long long addr, data = 0;
+            int                bytes;
+            int                fields;
+            replay_t           t;
+
+            lineno++;
+
+            if (line[0] != 'M' && line[0] != 'm')
+            {
+                continue;
+            }
+
+            fields = sscanf(line + 1, "%llx,%d:%llx", &addr, &bytes, &data);
+
+            if (fields < 2 || (line[0] == 'M' && fields < 3) || (bytes != 1 && bytes != 2 && bytes != 4 && bytes != 8))
+            {
+                VPrint("OsvvmCosimReplay: ***Error: bad socket script command at line %d: %s", lineno, line);
+                return false;
+            }
+
+            t.op     = (line[0] == 'M') ? WRITE_OP : READ_OP;
+            t.bytes  = bytes;
+            t.addr   = addr;
+            t.addr64 = addr > 0xffffffffULL;
+            t.wdata  = (line[0] == 'M') ? data : 0;
+            t.rdata  = (line[0] == 'm') ? data : 0;
+            t.check  = line[0] == 'm' && fields == 3;
+
+            trans.push_back(t);
+        }
+
+        return true;
+    }
+
+    int                   node;
+    int                   mismatches;
+    int                   skipped;
+    std::vector<replay_t> trans;
+};
+
+#endif
@@ -16,6 +16,7 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   ????.??    Added perfDump method
 //    05/2023   2023.05    Initial revision
 //
 //
@@ -139,6 +140,8 @@ public:
 
       void      waitForSim                   (void)                               {VWaitForSim(node);}
 
+      void      perfDump                     (void)                               {VPerfDump(node);}
+
       int       getNodeNumber                (void)                               {return node;}
 
 private:
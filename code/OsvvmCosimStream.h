@@ -15,6 +15,7 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   ????.??    Added perfDump method and scatter-gather burst overloads
 //    05/2023   2023.05    Adding additional methods mapping to OSVVM procedures
 //    02/2023   2023.02    Initial revision
 //
@@ -108,6 +109,7 @@ public:
 
       void     streamBurstSend                (uint8_t  *data,      const int bytesize, const int param=1) {VStreamUserBurstSendCommon               (SEND_BURST, BURST_NORM, data, bytesize, param, node);}
       void     streamBurstSend                (const int bytesize,  const int param=1)                     {VStreamUserBurstSendCommon               (SEND_BURST, BURST_TRANS, NULL, bytesize, param, node);}
+      void     streamBurstSend                (const vburst_iov_t *iov, const int iovcnt, const int param=1) {VStreamUserBurstSendIovCommon          (SEND_BURST, BURST_NORM, iov, iovcnt, param, node);}
       void     streamBurstSendAsync           (uint8_t  *data,      const int bytesize, const int param=1) {VStreamUserBurstSendCommon               (SEND_BURST_ASYNC, BURST_NORM, data, bytesize, param, node);}
       void     streamBurstSendAsync           (const int bytesize,  const int param=1)                     {VStreamUserBurstSendCommon               (SEND_BURST_ASYNC, BURST_TRANS, NULL, bytesize, param, node);}
 
@@ -115,6 +117,8 @@ public:
       void     streamBurstGet                 (uint8_t  *data,      const int  bytesize, int *status)      {VStreamUserBurstGetCommon                (GET_BURST, BURST_NORM,  data, bytesize, status, node);}
       void     streamBurstGet                 (const int bytesize)                                         {int status; VStreamUserBurstGetCommon    (GET_BURST, BURST_TRANS, NULL, bytesize, &status, node);}
       void     streamBurstGet                 (const int bytesize,        int *status)                     {VStreamUserBurstGetCommon                (GET_BURST, BURST_TRANS, NULL, bytesize, status, node);}
+      void     streamBurstGet                 (const vburst_iov_t *iov, const int iovcnt)                  {int status; VStreamUserBurstGetIovCommon (GET_BURST, BURST_NORM,  iov, iovcnt, &status, node);}
+      void     streamBurstGet                 (const vburst_iov_t *iov, const int iovcnt, int *status)     {VStreamUserBurstGetIovCommon             (GET_BURST, BURST_NORM,  iov, iovcnt, status, node);}
 
       void     streamBurstCheck               (uint8_t  *data,      const int bytesize, const int param=1) {VStreamUserBurstSendCommon               (CHECK_BURST, BURST_NORM,  data, bytesize, param, node);}
       void     streamBurstCheck               (const int bytesize,  const int param=1)                     {VStreamUserBurstSendCommon               (CHECK_BURST, BURST_TRANS, NULL, bytesize, param, node);}
@@ -148,6 +152,8 @@ public:
 
       void     waitForSim                     (void)                                                       {VWaitForSim(node);}
 
+      void     perfDump                       (void)                                                       {VPerfDump(node);}
+
       int      getNodeNumber                  (void)                                                       {return node;}
 
 private:
@@ -14,6 +14,7 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   ????.??    Co-sim API objects in a growable node registry
 //    07/2025   2025.??    Initial revision
 //
 //
@@ -44,7 +45,24 @@
 #define EXTERN extern
 #endif
 
-static OsvvmCosim *pcie[VP_MAX_NODES] = {{NULL}};
+static VNodeReg<OsvvmCosim> pcie;
+
+// -------------------------------------------------------------------------
+// Get the OSVVM co-sim API for a node, creating it if not yet registered
+// -------------------------------------------------------------------------
+
+static OsvvmCosim* getCosim (const unsigned int node)
+{
+    OsvvmCosim* cosim = pcie[node];
+
+    if (cosim == NULL)
+    {
+        cosim = new OsvvmCosim(node);
+        pcie.set(node, cosim);
+    }
+
+    return cosim;
+}
 
 // -------------------------------------------------------------------------
 // VProc style word write function to OSVVM co-sim write transaction call
@@ -54,20 +72,16 @@ EXTERN int VWrite (unsigned int addr, unsigned int data, int delta, unsigned int
 {
     int rdata = 0;
 
-    // Check if an OSVVM co-sim API for this node and create if not
-    if (pcie[node] == NULL)
-    {
-        pcie[node] = new OsvvmCosim(node);
-    }
+    OsvvmCosim* cosim = getCosim(node);
 
     // Do an asynchronous word write if delta set, else a normal write
     if (delta)
     {
-        rdata = pcie[node]->transWriteAsync(addr, (uint32_t)data);
+        rdata = cosim->transWriteAsync(addr, (uint32_t)data);
     }
     else
     {
-        rdata = pcie[node]->transWrite(addr, (uint32_t)data);
+        rdata = cosim->transWrite(addr, (uint32_t)data);
     }
 
     return rdata;
@@ -79,14 +93,10 @@ EXTERN int VWrite (unsigned int addr, unsigned int data, int delta, unsigned int
 
 EXTERN int VRead (unsigned int addr, unsigned int *data, int delta, unsigned int node)
 {
-    // Check if an OSVVM co-sim API for this node and create if not
-    if (pcie[node] == NULL)
-    {
-        pcie[node] = new OsvvmCosim(node);
-    }
+    OsvvmCosim* cosim = getCosim(node);
 
     // Do a word read
-    pcie[node]->transRead(addr, (uint32_t*)data);
+    cosim->transRead(addr, (uint32_t*)data);
 
     return 0;
 }
@@ -100,20 +110,16 @@ uint64_t VWrite64 (uint64_t addr, uint64_t data, int delta, unsigned int node)
 {
     uint64_t rdata = 0;
 
-    // Check if an OSVVM co-sim API for this node and create if not
-    if (pcie[node] == NULL)
-    {
-        pcie[node] = new OsvvmCosim(node);
-    }
+    OsvvmCosim* cosim = getCosim(node);
 
     // Do an asynchronous word write if delta set, else a normal write
     if (delta)
     {
-        rdata = pcie[node]->transWriteAsync(addr, data);
+        rdata = cosim->transWriteAsync(addr, data);
     }
     else
     {
-        rdata = pcie[node]->transWrite(addr, data);
+        rdata = cosim->transWrite(addr, data);
     }
 
     return rdata;
@@ -126,14 +132,10 @@ uint64_t VWrite64 (uint64_t addr, uint64_t data, int delta, unsigned int node)
 
 int VRead64(uint64_t addr, uint64_t *data, int delta, unsigned int node)
 {
-    // Check if an OSVVM co-sim API for this node and create if not
-    if (pcie[node] == NULL)
-    {
-        pcie[node] = new OsvvmCosim(node);
-    }
+    OsvvmCosim* cosim = getCosim(node);
 
     // Do a word read
-    pcie[node]->transRead(addr, data);
+    cosim->transRead(addr, data);
 
     return 0;
 }
@@ -0,0 +1,269 @@
+// =========================================================================
+//
+//  File Name:         OsvvmVCache.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Per node user side read cache, for address ranges declared as
+//      cacheable, such as ROM, instruction memory or constant ID
+//      registers. The cache is direct mapped, with lines of
+//      VP_CACHE_LINE_SIZE bytes, filled by a single burst read on a
+//      miss. Writes are written through, updating any cached line, or
+//      invalidate the lines they overlap.
+//      The cache is only accessed by the user thread, with the node's
+//      access mutex held.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Writes that are not written through invalidate lines
+//    10/2026   ????.??    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_VCACHE_H_
+#define _OSVVM_VCACHE_H_
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string.h>
+
+// -------------------------------------------------------------------------
+// DEFINES AND MACROS
+// -------------------------------------------------------------------------
+
+// Size of a cache line, in bytes (must be a power of 2, no larger than a burst buffer)
+#ifndef VP_CACHE_LINE_SIZE
+#define VP_CACHE_LINE_SIZE      64
+#endif
+
+// Number of cache lines per node (must be a power of 2)
+#ifndef VP_CACHE_LINES
+#define VP_CACHE_LINES          256
+#endif
+
+// Maximum number of cacheable address ranges per node
+#ifndef VP_CACHE_RANGES
+#define VP_CACHE_RANGES         8
+#endif
+
+// -------------------------------------------------------------------------
+// TYPEDEFS
+// -------------------------------------------------------------------------
+
+typedef struct
+{
+    uint64_t              base;
+    uint64_t              size;
+} vcache_range_t;
+
+typedef struct
+{
+    bool                  valid;
+    uint64_t              tag;        // Line aligned address of the cached data
+    uint8_t               data[VP_CACHE_LINE_SIZE];
+} vcache_line_t;
+
+// A node's cache. No lines are filled while there are no ranges.
+typedef struct
+{
+    int                   num_ranges;
+    vcache_range_t        range[VP_CACHE_RANGES];
+    vcache_line_t         line[VP_CACHE_LINES];
+    uint64_t              hits;
+    uint64_t              misses;
+} vcache_t;
+
+// -------------------------------------------------------------------------
+// FUNCTION DEFINITIONS
+// -------------------------------------------------------------------------
+
+// -------------------------------------------------------------------------
+// VCacheInit()
+//
+// Initialise a node's cache to have no ranges and no valid lines
+//
+// -------------------------------------------------------------------------
+
+static inline void VCacheInit (vcache_t* c)
+{
+    c->num_ranges = 0;
+    c->hits       = 0;
+    c->misses     = 0;
+
+    for (int idx = 0; idx < VP_CACHE_LINES; idx++)
+    {
+        c->line[idx].valid = false;
+    }
+}
+
+// -------------------------------------------------------------------------
+// VCacheLine()
+//
+// The line that may hold the data at addr
+//
+// -------------------------------------------------------------------------
+
+static inline vcache_line_t* VCacheLine (vcache_t* c, const uint64_t addr)
+{
+    return &c->line[(addr / VP_CACHE_LINE_SIZE) & (VP_CACHE_LINES - 1)];
+}
+
+// -------------------------------------------------------------------------
+// VCacheable()
+//
+// Whether an access of bytes at addr is cacheable. It must lie in a
+// single line, and in a declared range.
+//
+// -------------------------------------------------------------------------
+
+static inline bool VCacheable (vcache_t* c, const uint64_t addr, const int bytes)
+{
+    if (((addr ^ (addr + bytes - 1)) & ~(uint64_t)(VP_CACHE_LINE_SIZE - 1)) != 0)
+    {
+        return false;
+    }
+
+    for (int idx = 0; idx < c->num_ranges; idx++)
+    {
+        if (addr - c->range[idx].base < c->range[idx].size && addr + bytes - c->range[idx].base <= c->range[idx].size)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// -------------------------------------------------------------------------
+// VCacheLookup()
+//
+// Fetch the data of a cacheable access of bytes at addr, if its line is
+// valid. Returns false on a miss.
+//
+// -------------------------------------------------------------------------
+
+static inline bool VCacheLookup (vcache_t* c, const uint64_t addr, const int bytes, uint64_t* data)
+{
+    vcache_line_t* line = VCacheLine(c, addr);
+    uint64_t       tag  = addr & ~(uint64_t)(VP_CACHE_LINE_SIZE - 1);
+
+    if (!line->valid || line->tag != tag)
+    {
+        return false;
+    }
+
+    *data = 0;
+    memcpy(data, &line->data[addr - tag], bytes);
+
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// VCacheInvalidateLines()
+//
+// Invalidate all lines overlapping the size bytes at addr. Only the
+// lines that could hold the bytes are checked, unless there are more
+// of those than there are lines.
+//
+// -------------------------------------------------------------------------
+
+static inline void VCacheInvalidateLines (vcache_t* c, const uint64_t addr, const uint64_t size)
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    if (size <= (uint64_t)VP_CACHE_LINES * VP_CACHE_LINE_SIZE)
+    {
+        uint64_t first = addr & ~(uint64_t)(VP_CACHE_LINE_SIZE - 1);
+        uint64_t last  = (addr + size - 1) & ~(uint64_t)(VP_CACHE_LINE_SIZE - 1);
+
+        for (uint64_t tag = first; ; tag += VP_CACHE_LINE_SIZE)
+        {
+            vcache_line_t* line = VCacheLine(c, tag);
+
+            if (line->valid && line->tag == tag)
+            {
+                line->valid = false;
+            }
+
+            if (tag == last)
+            {
+                break;
+            }
+        }
+
+        return;
+    }
+
+    for (int idx = 0; idx < VP_CACHE_LINES; idx++)
+    {
+        uint64_t tag = c->line[idx].tag;
+
+        if (c->line[idx].valid && (tag >= addr ? tag - addr < size : addr - tag < VP_CACHE_LINE_SIZE))
+        {
+            c->line[idx].valid = false;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------
+// VCacheWrite()
+//
+// Write through the data of a write of bytes at addr to its line, if
+// cached. Lines are not allocated on writes. A write that is not
+// cacheable, as it straddles lines or a range's boundary, invalidates
+// all the lines it overlaps instead.
+//
+// -------------------------------------------------------------------------
+
+static inline void VCacheWrite (vcache_t* c, const uint64_t addr, const int bytes, const uint64_t data)
+{
+    if (c->num_ranges == 0)
+    {
+        return;
+    }
+
+    if (!VCacheable(c, addr, bytes))
+    {
+        VCacheInvalidateLines(c, addr, bytes);
+        return;
+    }
+
+    vcache_line_t* line = VCacheLine(c, addr);
+    uint64_t       tag  = addr & ~(uint64_t)(VP_CACHE_LINE_SIZE - 1);
+
+    if (line->valid && line->tag == tag)
+    {
+        memcpy(&line->data[addr - tag], &data, bytes);
+    }
+}
+
+#endif
@@ -0,0 +1,215 @@
+// =========================================================================
+//
+//  File Name:         OsvvmVIrq.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Per node interrupt event queue. Each call of VIrqVec by the
+//      simulator, and each change of the interrupt vector input to
+//      VTrans, pushes the new interrupt vector, timestamped with the
+//      node's VTrans call count, to a single producer, single consumer
+//      lock free ring, without blocking. The events are drained, in
+//      order, on the user side, calling the node's registered
+//      interrupt callback for each, either at the next message
+//      exchange or by a dedicated ISR thread calling VIrqDrain, or
+//      VIrqWait to sleep until there are events. A push only makes a
+//      system call to wake the ISR thread if it is asleep.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Added blocking wait for interrupt events
+//    10/2026   ????.??    Interrupt vector input changes queued, and overflow
+//                         made an error, with a configurable queue size
+//    10/2026   ????.??    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_VIRQ_H_
+#define _OSVVM_VIRQ_H_
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include <sched.h>
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
+#include "OsvvmVQueue.h"
+
+// -------------------------------------------------------------------------
+// DEFINES AND MACROS
+// -------------------------------------------------------------------------
+
+// Number of entries in each node's interrupt event queue (must be a power of 2)
+#ifndef VP_IRQ_QUEUE_SIZE
+#define VP_IRQ_QUEUE_SIZE       1024
+#endif
+
+// -------------------------------------------------------------------------
+// TYPEDEFS
+// -------------------------------------------------------------------------
+
+// Interrupt vector edge event
+typedef struct
+{
+    uint64_t                   timestamp;  // Node's VTrans call count when raised
+    uint32_t                   vec;
+} virq_event_t;
+
+// A node's interrupt event queue. The ring is only pushed to on the
+// simulator side. Popping is serialised by the queue's mutex, which the
+// simulator side never takes and which is not held while calling the
+// interrupt callback.
+typedef struct
+{
+    vqueue_ring_t<virq_event_t, VP_IRQ_QUEUE_SIZE> ring;
+    std::atomic<uint32_t>       seq;        // Count of pushes and wakes, slept on by waiters
+    std::atomic<uint32_t>       waiting;    // Number of waiters (about to be) asleep on seq
+    std::atomic<bool>           exch_drain; // Drain at each message exchange
+    uint64_t                    cur_time;   // Timestamp of the event being serviced
+    std::mutex                  mx;
+} virq_queue_t;
+
+// -------------------------------------------------------------------------
+// FUNCTION DEFINITIONS
+// -------------------------------------------------------------------------
+
+// -------------------------------------------------------------------------
+// VIrqInit()
+//
+// Initialise a node's interrupt event queue to empty, drained at each
+// message exchange
+//
+// -------------------------------------------------------------------------
+
+static inline void VIrqInit (virq_queue_t* q)
+{
+    q->ring.head.store(0);
+    q->ring.tail.store(0);
+    q->seq.store(0);
+    q->waiting.store(0);
+    q->exch_drain.store(true);
+    q->cur_time   = 0;
+}
+
+// -------------------------------------------------------------------------
+// VIrqWake()
+//
+// Wake any threads asleep in VIrqSleep(), only making a system call if
+// there are any
+//
+// -------------------------------------------------------------------------
+
+static inline void VIrqWake (virq_queue_t* q)
+{
+    q->seq.fetch_add(1);
+
+    if (q->waiting.load())
+    {
+#if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&q->seq), FUTEX_WAKE_PRIVATE, INT32_MAX, NULL, NULL, 0);
+#endif
+    }
+}
+
+// -------------------------------------------------------------------------
+// VIrqPush()
+//
+// Simulator side push of an interrupt vector event, waking any sleeping
+// ISR thread. Returns false if the ring is full, as the simulator
+// cannot wait for the user side.
+//
+// -------------------------------------------------------------------------
+
+static inline bool VIrqPush (virq_queue_t* q, const uint64_t timestamp, const uint32_t vec)
+{
+    virq_event_t event = {timestamp, vec};
+
+    if (!VQueuePush(&q->ring, event))
+    {
+        return false;
+    }
+
+    VIrqWake(q);
+
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// VIrqSleep()
+//
+// Sleep until there are interrupt events in the queue, or a VIrqWake()
+// call. Returns immediately if there are events already.
+//
+// -------------------------------------------------------------------------
+
+static inline void VIrqSleep (virq_queue_t* q)
+{
+    uint32_t seq = q->seq.load();
+
+    if (VQueueCount(&q->ring) > 0)
+    {
+        return;
+    }
+
+    // Flag sleeping before the final check, so a push or wake either sees
+    // the flag or is seen by the check
+    q->waiting.fetch_add(1);
+
+    if (q->seq.load() == seq)
+    {
+#if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&q->seq), FUTEX_WAIT_PRIVATE, seq, NULL, NULL, 0);
+#else
+        sched_yield();
+#endif
+    }
+
+    q->waiting.fetch_sub(1);
+}
+
+// -------------------------------------------------------------------------
+// VIrqPending()
+//
+// Returns true if there are interrupt events to be drained at the next
+// message exchange
+//
+// -------------------------------------------------------------------------
+
+static inline bool VIrqPending (virq_queue_t* q)
+{
+    return q->exch_drain.load(std::memory_order_relaxed) && VQueueCount(&q->ring) > 0;
+}
+
+#endif
@@ -0,0 +1,361 @@
+// =========================================================================
+//
+//  File Name:         OsvvmVLog.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Logging backend for VPrint, printing synchronously or buffering
+//      messages in per thread lock-free rings written out by a flusher
+//      thread (see OsvvmVLog.h)
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Line state tracked per node within a ring
+//    10/2026   ????.??    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <string.h>
+#include "OsvvmVProc.h"
+#include "OsvvmVUser.h"
+#include "OsvvmVLog.h"
+
+#if !defined(_WIN32) && !defined(ALDEC)
+#define VP_HAVE_BUFFERED_LOG
+#endif
+
+#if defined(VP_HAVE_BUFFERED_LOG)
+
+#include <atomic>
+#include <mutex>
+#include <new>
+
+// -------------------------------------------------------------------------
+// TYPEDEFS
+// -------------------------------------------------------------------------
+
+// A buffered message, and the node and tick that it is tagged with
+typedef struct
+{
+    int                   node;
+    uint64_t              tick;
+    char                  msg[VP_LOG_MSG_SIZE];
+} vlog_msg_t;
+
+// Ring of messages written by one thread and read by the flusher, with
+// head and tail free running counts of messages written and read
+typedef struct vlog_ring_s
+{
+    alignas(VP_CACHE_LINE_SIZE)
+    std::atomic<uint64_t> head;
+    alignas(VP_CACHE_LINE_SIZE)
+    std::atomic<uint64_t> tail;
+    int                   line_node;   // Node with an unterminated line, else VLOG_LINE_START (flusher owned)
+    struct vlog_ring_s*   next;
+    vlog_msg_t            msgs[VP_LOG_RING_SIZE];
+} vlog_ring_t;
+
+// Ring line state when the last message written ended its line. Nodes
+// are >= 0, and -1 tags messages not from user code.
+#define VLOG_LINE_START (-2)
+
+static_assert((VP_LOG_RING_SIZE & (VP_LOG_RING_SIZE - 1)) == 0, "VP_LOG_RING_SIZE must be a power of 2");
+
+// -------------------------------------------------------------------------
+// LOCAL STATE
+// -------------------------------------------------------------------------
+
+static std::atomic<bool>     vp_log_buffered(false);
+
+// List of all threads' rings, only added to, and the lock serialising
+// additions to the list and the draining of the rings
+static std::atomic<vlog_ring_t*> vp_log_rings(NULL);
+static std::mutex                vp_log_list_mx;
+static std::mutex                vp_log_drain_mx;
+
+static thread_local vlog_ring_t* vp_log_ring = NULL;
+
+#endif
+
+static thread_local int          vp_log_node = -1;
+
+#if defined(VP_HAVE_BUFFERED_LOG)
+
+// -------------------------------------------------------------------------
+// VLogGetRing()
+//
+// Get the calling thread's ring, creating it on first use
+//
+// -------------------------------------------------------------------------
+
+static vlog_ring_t* VLogGetRing (void)
+{
+    if (vp_log_ring == NULL)
+    {
+        void* mem;
+
+        if (posix_memalign(&mem, alignof(vlog_ring_t), sizeof(vlog_ring_t)) != 0)
+        {
+            return NULL;
+        }
+
+        vlog_ring_t* ring = new (mem) vlog_ring_t;
+
+        ring->head.store(0);
+        ring->tail.store(0);
+        ring->line_node  = VLOG_LINE_START;
+
+        std::lock_guard<std::mutex> lock(vp_log_list_mx);
+
+        ring->next = vp_log_rings.load();
+        vp_log_rings.store(ring, std::memory_order_release);
+
+        vp_log_ring = ring;
+    }
+
+    return vp_log_ring;
+}
+
+// -------------------------------------------------------------------------
+// VLogDrain()
+//
+// Write out the messages in all the rings, returning the number written.
+// Each line is prefixed with its node and tick, or "sim" for messages not
+// from user code. In pool mode several nodes share a worker's ring, so a
+// line left unterminated by one node is ended when another node's message
+// follows it, and the new message prefixed.
+//
+// -------------------------------------------------------------------------
+
+static int VLogDrain (void)
+{
+    std::lock_guard<std::mutex> lock(vp_log_drain_mx);
+
+    int count = 0;
+
+    for (vlog_ring_t* ring = vp_log_rings.load(std::memory_order_acquire); ring != NULL; ring = ring->next)
+    {
+        uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+
+        for (; tail != head; tail++, count++)
+        {
+            vlog_msg_t* m   = &ring->msgs[tail & (VP_LOG_RING_SIZE - 1)];
+            size_t      len = strlen(m->msg);
+
+            if (ring->line_node != m->node)
+            {
+                if (ring->line_node != VLOG_LINE_START)
+                {
+                    fputc('\n', stdout);
+                }
+
+                if (m->node >= 0)
+                {
+                    printf("[node %d @%llu] ", m->node, (unsigned long long)m->tick);
+                }
+                else
+                {
+                    printf("[sim] ");
+                }
+            }
+
+            fwrite(m->msg, 1, len, stdout);
+
+            ring->line_node = (len > 0 && m->msg[len-1] == '\n') ? VLOG_LINE_START : m->node;
+        }
+
+        ring->tail.store(tail, std::memory_order_release);
+    }
+
+    if (count)
+    {
+        fflush(stdout);
+    }
+
+    return count;
+}
+
+// -------------------------------------------------------------------------
+// VLogFlusher()
+//
+// Background flusher thread, sleeping when there is nothing to write
+//
+// -------------------------------------------------------------------------
+
+static void* VLogFlusher (void* /*arg*/)
+{
+    while (true)
+    {
+        if (VLogDrain() == 0)
+        {
+            usleep(VP_LOG_FLUSH_USECS);
+        }
+    }
+
+    return NULL;
+}
+
+#endif
+
+// -------------------------------------------------------------------------
+// VLogInit()
+//
+// Select the logging mode from the environment. Called at the first VInit.
+//
+// -------------------------------------------------------------------------
+
+void VLogInit (void)
+{
+    const char* mode     = getenv(VP_LOG_ENV);
+#if defined(VP_BUFFERED_LOG)
+    bool        buffered = true;
+#else
+    bool        buffered = false;
+#endif
+
+    if (mode != NULL)
+    {
+        if (strcasecmp(mode, "BUFFERED") == 0)
+        {
+            buffered = true;
+        }
+        else if (strcasecmp(mode, "SYNC") == 0)
+        {
+            buffered = false;
+        }
+        else
+        {
+            VPrint("***Warning: VInit() ignoring unrecognised %s value \"%s\"\n", VP_LOG_ENV, mode);
+        }
+    }
+
+#if defined(VP_HAVE_BUFFERED_LOG)
+    pthread_t thread;
+
+    if (buffered && !vp_log_buffered)
+    {
+        if (pthread_create(&thread, NULL, VLogFlusher, NULL) != 0)
+        {
+            VPrint("***Warning: VInit() failed to start log flusher thread. Using SYNC\n");
+            return;
+        }
+
+        pthread_detach(thread);
+        atexit(VLogFlush);
+
+        vp_log_buffered = true;
+    }
+#else
+    if (buffered)
+    {
+        VPrint("***Warning: VInit() buffered logging not supported in this build. Using SYNC\n");
+    }
+#endif
+}
+
+// -------------------------------------------------------------------------
+// VLogPrint()
+//
+// Print a message. When buffered, the message is formatted into the
+// calling thread's ring, waiting for the flusher if the ring is full.
+// Arguments are formatted here, as they need not outlive the call.
+//
+// -------------------------------------------------------------------------
+
+void VLogPrint (const char* format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+
+#if defined(VP_HAVE_BUFFERED_LOG)
+    vlog_ring_t* ring;
+
+    if (vp_log_buffered.load(std::memory_order_relaxed) && (ring = VLogGetRing()) != NULL)
+    {
+        uint64_t head = ring->head.load(std::memory_order_relaxed);
+
+        while (head - ring->tail.load(std::memory_order_acquire) >= VP_LOG_RING_SIZE)
+        {
+            sched_yield();
+        }
+
+        vlog_msg_t*   m     = &ring->msgs[head & (VP_LOG_RING_SIZE - 1)];
+        pSchedState_t state = vp_log_node >= 0 ? ns[vp_log_node] : NULL;
+
+        m->node = vp_log_node;
+        m->tick = state ? state->vtrans_calls.load(std::memory_order_relaxed) : 0;
+
+        vsnprintf(m->msg, VP_LOG_MSG_SIZE, format, args);
+
+        ring->head.store(head + 1, std::memory_order_release);
+
+        va_end(args);
+        return;
+    }
+#endif
+
+    vprintf(format, args);
+
+    va_end(args);
+}
+
+// -------------------------------------------------------------------------
+// VLogFlush()
+//
+// Write out all buffered messages (e.g. before exit, or from a crash
+// handler)
+//
+// -------------------------------------------------------------------------
+
+void VLogFlush (void)
+{
+#if defined(VP_HAVE_BUFFERED_LOG)
+    if (vp_log_buffered)
+    {
+        VLogDrain();
+    }
+#endif
+
+    fflush(stdout);
+}
+
+// -------------------------------------------------------------------------
+// VLogSetNode()
+//
+// Set the node whose user code is running on the calling thread, to tag
+// its messages with
+//
+// -------------------------------------------------------------------------
+
+void VLogSetNode (const int node)
+{
+    vp_log_node = node;
+}
@@ -0,0 +1,101 @@
+// =========================================================================
+//
+//  File Name:         OsvvmVLog.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Logging backend for VPrint. Synchronous by default, printing
+//      directly on the calling thread. When the OSVVM_COSIM_LOG
+//      environment variable is set to BUFFERED (or compiled with
+//      VP_BUFFERED_LOG defined), each thread's messages are formatted
+//      into its own lock-free ring, and written to stdout by a background
+//      flusher thread, with each line tagged with the node and the node's
+//      VTrans call count. Remaining messages are flushed at exit.
+//
+//      Buffered logging is not available under Windows or Aldec, where
+//      VPrint does not use this backend.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_VLOG_H_
+#define _OSVVM_VLOG_H_
+
+// -------------------------------------------------------------------------
+// DEFINES AND MACROS
+// -------------------------------------------------------------------------
+
+// Environment variable to select the logging mode ("SYNC" or "BUFFERED")
+#define VP_LOG_ENV              "OSVVM_COSIM_LOG"
+
+// Maximum length of a buffered message, with longer messages truncated
+#ifndef VP_LOG_MSG_SIZE
+#define VP_LOG_MSG_SIZE         256
+#endif
+
+// Number of messages in each thread's ring (a power of 2)
+#ifndef VP_LOG_RING_SIZE
+#define VP_LOG_RING_SIZE        1024
+#endif
+
+// Flusher sleep time when all rings are empty
+#define VP_LOG_FLUSH_USECS      1000
+
+#if defined(__GNUC__)
+#define VP_LOG_PRINTF_ATTR      __attribute__((format(printf, 1, 2)))
+#else
+#define VP_LOG_PRINTF_ATTR
+#endif
+
+// -------------------------------------------------------------------------
+// EXTERNAL DECLARATIONS
+// -------------------------------------------------------------------------
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Select the logging mode from the environment, starting the flusher
+// thread if buffered
+extern void VLogInit    (void);
+
+// Print a message, synchronously or to the calling thread's ring
+extern void VLogPrint   (const char* format, ...) VP_LOG_PRINTF_ATTR;
+
+// Write out all buffered messages
+extern void VLogFlush   (void);
+
+// Set the node whose user code is running on the calling thread, or -1
+extern void VLogSetNode (const int node);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,154 @@
+// =========================================================================
+//
+//  File Name:         OsvvmVNodeReg.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Growable registry of per node objects, indexed by node number.
+//      A two level table of fixed size chunks of pointers, with chunks
+//      allocated as nodes are registered, so that a pointer, once
+//      registered, never moves and lookups need no lock. Registration
+//      is serialised with a mutex, and notifies any thread waiting for
+//      a node to be registered.
+//
+//      The number of nodes is limited only by VP_MAX_NODES, which sizes
+//      the top level table of chunk pointers.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Added wait for registration
+//    10/2026   ????.??    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_VNODEREG_H_
+#define _OSVVM_VNODEREG_H_
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+// -------------------------------------------------------------------------
+// DEFINES AND MACROS
+// -------------------------------------------------------------------------
+
+#ifndef VP_MAX_NODES
+#define VP_MAX_NODES            65536
+#endif
+
+#define VP_NODE_CHUNK_BITS      6
+#define VP_NODE_CHUNK_SIZE      (1 << VP_NODE_CHUNK_BITS)
+#define VP_NODE_CHUNK_MASK      (VP_NODE_CHUNK_SIZE - 1)
+#define VP_NODE_NUM_CHUNKS      ((VP_MAX_NODES + VP_NODE_CHUNK_SIZE - 1) / VP_NODE_CHUNK_SIZE)
+
+// -------------------------------------------------------------------------
+// CLASS DEFINITIONS
+// -------------------------------------------------------------------------
+
+// Registry of pointers to objects of type T, with static storage so that
+// the table is zero initialised before any constructor runs
+template <typename T> class VNodeReg
+{
+public:
+
+    // Pointer registered for a node, or NULL if none (or out of range)
+    T*           operator[] (const uint32_t node) const
+    {
+        if (node >= VP_MAX_NODES)
+        {
+            return NULL;
+        }
+
+        std::atomic<T*>* chunk = chunks[node >> VP_NODE_CHUNK_BITS].load(std::memory_order_acquire);
+
+        return chunk ? chunk[node & VP_NODE_CHUNK_MASK].load(std::memory_order_acquire) : NULL;
+    }
+
+    // Register a pointer for a node, replacing any already registered,
+    // returning false if the node is out of range
+    bool         set        (const uint32_t node, T* obj)
+    {
+        if (node >= VP_MAX_NODES)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(reg_mx);
+
+        std::atomic<T*>* chunk = chunks[node >> VP_NODE_CHUNK_BITS].load(std::memory_order_relaxed);
+
+        if (chunk == NULL)
+        {
+            chunk = new std::atomic<T*>[VP_NODE_CHUNK_SIZE];
+
+            for (int idx = 0; idx < VP_NODE_CHUNK_SIZE; idx++)
+            {
+                chunk[idx].store(NULL, std::memory_order_relaxed);
+            }
+
+            chunks[node >> VP_NODE_CHUNK_BITS].store(chunk, std::memory_order_release);
+        }
+
+        chunk[node & VP_NODE_CHUNK_MASK].store(obj, std::memory_order_release);
+
+        if (node >= num_nodes)
+        {
+            num_nodes = node + 1;
+        }
+
+        reg_cv.notify_all();
+
+        return true;
+    }
+
+    // Wait for a node to be registered, returning its pointer, or NULL if
+    // not registered within timeout_secs seconds
+    T*           wait       (const uint32_t node, const int timeout_secs)
+    {
+        std::unique_lock<std::mutex> lock(reg_mx);
+
+        reg_cv.wait_for(lock, std::chrono::seconds(timeout_secs), [&] {return (*this)[node] != NULL;});
+
+        return (*this)[node];
+    }
+
+    // One more than the highest registered node number
+    uint32_t     size       (void) const {return num_nodes;}
+
+private:
+    std::atomic<std::atomic<T*>*> chunks[VP_NODE_NUM_CHUNKS];
+    std::mutex                    reg_mx;
+    std::condition_variable       reg_cv;
+    uint32_t                      num_nodes;
+};
+
+#endif
@@ -0,0 +1,243 @@
+// =========================================================================
+//
+//  File Name:         OsvvmVPerf.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Per node performance counters, compiled in when VP_PERF_COUNTERS
+//      is defined (e.g. make USRFLAGS=-DVP_PERF_COUNTERS). Counts the
+//      messages from the user code by operation and transaction type,
+//      and the burst bytes transferred. The wall clock time of each node
+//      is split between the user code, the handshake between user and
+//      simulator threads, and the simulator (time outside of the node's
+//      VTrans calls), with a log2 histogram of handshake latencies.
+//
+//      Timestamps are from the time stamp counter, where available,
+//      scaled to nanoseconds when the counters are dumped. When not
+//      compiled in, the macros are empty and there is no node state.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_VPERF_H_
+#define _OSVVM_VPERF_H_
+
+#if defined(VP_PERF_COUNTERS)
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// -------------------------------------------------------------------------
+// DEFINES AND MACROS
+// -------------------------------------------------------------------------
+
+// Operations above VPERF_NUM_OPS-1 (e.g. CoSim operations) are counted
+// in the last entry
+#define VPERF_NUM_OPS           64
+#define VPERF_NUM_TYPES         32
+#define VPERF_HIST_BUCKETS      64
+
+#define VPERF_INIT(_p)          VPerfInit(&(_p))
+#define VPERF_VTRANS_ENTRY(_p)  {uint64_t _t = VPerfNow(); if ((_p).vtrans_exit) (_p).sim_ticks += _t - (_p).vtrans_exit;}
+#define VPERF_VTRANS_EXIT(_p)   {(_p).vtrans_exit = VPerfNow();}
+#define VPERF_SIM_POST(_p)      {(_p).sim_post    = VPerfNow();}
+#define VPERF_SIM_WAKE(_p)      VPerfSimWake(&(_p))
+#define VPERF_USER_POST(_p)     {(_p).user_post   = VPerfNow();}
+#define VPERF_USER_WAKE(_p)     {(_p).user_wake   = VPerfNow();}
+#define VPERF_COUNT(_p, _op, _type, _bytes) VPerfCount(&(_p), _op, _type, _bytes)
+
+// -------------------------------------------------------------------------
+// TYPEDEFS
+// -------------------------------------------------------------------------
+
+typedef struct
+{
+    uint64_t            op_count[VPERF_NUM_OPS];
+    uint64_t            type_count[VPERF_NUM_TYPES];
+    uint64_t            burst_bytes;
+    uint64_t            exchanges;
+
+    // Accumulated time, in time stamp counter ticks
+    uint64_t            user_ticks;
+    uint64_t            hshake_ticks;
+    uint64_t            sim_ticks;
+    uint64_t            hist[VPERF_HIST_BUCKETS];
+
+    // Reference points for scaling ticks to nanoseconds
+    uint64_t            start_tsc;
+    uint64_t            start_ns;
+
+    // Timestamps of the current exchange. The user timestamps are written
+    // by the user thread, and read by the simulator thread after the handshake
+    uint64_t            vtrans_exit;
+    uint64_t            sim_post;
+    uint64_t            user_post;
+    uint64_t            user_wake;
+} vperf_t;
+
+// -------------------------------------------------------------------------
+// FUNCTION DEFINITIONS
+// -------------------------------------------------------------------------
+
+// -------------------------------------------------------------------------
+// VPerfClockNs()
+//
+// Monotonic wall clock time in nanoseconds
+//
+// -------------------------------------------------------------------------
+
+static inline uint64_t VPerfClockNs (void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// -------------------------------------------------------------------------
+// VPerfNow()
+//
+// Timestamp in ticks of the time stamp counter, or nanoseconds if none
+//
+// -------------------------------------------------------------------------
+
+static inline uint64_t VPerfNow (void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return VPerfClockNs();
+#endif
+}
+
+// -------------------------------------------------------------------------
+// VPerfInit()
+//
+// Clear a node's counters and set the reference points for scaling
+//
+// -------------------------------------------------------------------------
+
+static inline void VPerfInit (vperf_t* p)
+{
+    memset(p, 0, sizeof(vperf_t));
+
+    p->start_tsc = VPerfNow();
+    p->start_ns  = VPerfClockNs();
+}
+
+// -------------------------------------------------------------------------
+// VPerfNsPerTick()
+//
+// Nanoseconds per timestamp tick, measured since the counters were
+// initialised
+//
+// -------------------------------------------------------------------------
+
+static inline double VPerfNsPerTick (const vperf_t* p)
+{
+    uint64_t ticks = VPerfNow()     - p->start_tsc;
+    uint64_t ns    = VPerfClockNs() - p->start_ns;
+
+    return ticks ? (double)ns / ticks : 1.0;
+}
+
+// -------------------------------------------------------------------------
+// VPerfSimWake()
+//
+// Called by the simulator thread when the user thread has replied to
+// the simulator's message. The handshake latency is the time from the
+// simulator's post to the user thread waking, plus that from the user
+// thread's post to the simulator waking, with the time in between
+// spent in the user code.
+//
+// -------------------------------------------------------------------------
+
+static inline void VPerfSimWake (vperf_t* p)
+{
+    uint64_t now = VPerfNow();
+
+    // Not a reply to the simulator's last post (e.g. the first message)
+    if (p->user_wake < p->sim_post || p->user_post < p->user_wake)
+    {
+        return;
+    }
+
+    uint64_t hshake = (p->user_wake - p->sim_post) + (now - p->user_post);
+
+    p->hshake_ticks += hshake;
+    p->user_ticks   += p->user_post - p->user_wake;
+    p->exchanges++;
+
+    p->hist[hshake ? 63 - __builtin_clzll(hshake) : 0]++;
+}
+
+// -------------------------------------------------------------------------
+// VPerfCount()
+//
+// Count a message from the user code by operation and type. Queued
+// transactions have no type, and are passed a type of -1.
+//
+// -------------------------------------------------------------------------
+
+static inline void VPerfCount (vperf_t* p, const int op, const int type, const int bytes)
+{
+    p->op_count[(op >= 0 && op < VPERF_NUM_OPS) ? op : VPERF_NUM_OPS-1]++;
+
+    if (type >= 0)
+    {
+        p->type_count[type & (VPERF_NUM_TYPES-1)]++;
+    }
+
+    p->burst_bytes += bytes;
+}
+
+#else
+
+#define VPERF_INIT(_p)
+#define VPERF_VTRANS_ENTRY(_p)
+#define VPERF_VTRANS_EXIT(_p)
+#define VPERF_SIM_POST(_p)
+#define VPERF_SIM_WAKE(_p)
+#define VPERF_USER_POST(_p)
+#define VPERF_USER_WAKE(_p)
+#define VPERF_COUNT(_p, _op, _type, _bytes)
+
+#endif
+
+#endif
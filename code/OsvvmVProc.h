@@ -15,6 +15,20 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   ????.??    No node state access mutex for GHDL
+//    10/2026   ????.??    Pool worker in node state, and POOL_COLLECT operation
+//    10/2026   ????.??    Interrupt event queue in node state
+//    10/2026   ????.??    Scatter-gather burst data segment type
+//    10/2026   ????.??    User side read cache in node state
+//    10/2026   ????.??    Added READ_POLL operation, with read poll flag in node state
+//    10/2026   ????.??    Atomic VTrans call count in node state, for log tags
+//    10/2026   ????.??    Node state in a growable node registry, with access mutex
+//    10/2026   ????.??    Binary transaction trace recorder
+//    10/2026   ????.??    Optional performance counters in node state
+//    10/2026   ????.??    Transaction submission queue in node state
+//    10/2026   ????.??    Coroutine state, and pool dispatch flag, in node state
+//    10/2026   ????.??    Double banked burst data buffers
+//    10/2026   ????.??    Node handshake selectable between semaphores and spin-then-sleep
 //    10/2023   2023.09    Fixes for sync'ing operation enumerated types
 //    05/2023   2023.05    Adding asynchronous transaction support
 //    03/2023   2023.04    Adding basic stream support
@@ -65,6 +79,15 @@
 
 #include <semaphore.h>
 
+#include "OsvvmVSync.h"
+#include "OsvvmVQueue.h"
+#include "OsvvmVCache.h"
+#include "OsvvmVIrq.h"
+#include "OsvvmVPerf.h"
+#include "OsvvmVTrace.h"
+#include "OsvvmVNodeReg.h"
+#include "OsvvmVLog.h"
+
 // For file IO
 #include <fcntl.h>
 
@@ -75,10 +98,6 @@
 // DEFINES AND MACROS
 // -------------------------------------------------------------------------
 
-#ifndef VP_MAX_NODES
-#define VP_MAX_NODES            64
-#endif
-
 #define VP_EXIT_OK              0
 #define VP_QUEUE_ERR            1
 #define VP_KEY_ERR              2
@@ -89,6 +108,16 @@
 #define DEFAULT_STR_BUF_SIZE    32
 #define DATABUF_SIZE            4096
 
+// Number of burst data buffers, so that a chunk of a large burst may be
+// staged while the previous one is processed
+#define DATABUF_BANKS           2
+
+// Byte index, in a READ_POLL's burst write data, of the stop on interrupt
+// word, following the mask and maximum number of reads. Its low word
+// requests that the poll ends when a VIrqVec interrupt is raised, and its
+// high word is set when one is.
+#define VP_POLL_IRQ_IDX         16
+
 // -------------------------------------------------------------------------
 // TYPEDEFS
 // -------------------------------------------------------------------------
@@ -183,7 +212,10 @@ typedef enum addr_bus_trans_op_e
     
     MULTIPLE_DRIVER_DETECT,
 
-    SET_TEST_NAME = 1024
+    SET_TEST_NAME = 1024,
+    QUEUE_DRAIN,
+    READ_POLL,
+    POOL_COLLECT
 } addr_bus_trans_op_t;
 
 typedef enum stream_operation_e
@@ -230,6 +262,13 @@ typedef enum burst_write_type_e
     BURST_FIFO_CHECK,
 } burst_type_t;
 
+// Segment of scatter-gather burst data
+typedef struct
+{
+    uint8_t*            base;
+    int                 len;
+} vburst_iov_t;
+
 typedef struct
 {
     addr_bus_trans_op_t op;
@@ -238,9 +277,11 @@ typedef struct
     uint64_t            addr;
     uint8_t             data[16];
     int                 num_burst_bytes;
-    uint8_t             databuf[DATABUF_SIZE];
+    int                 buf_sel;
+    uint8_t             databuf[DATABUF_BANKS][DATABUF_SIZE];
     int                 param;
     int                 ticks;
+    int                 tick_count;
     int                 done;
     int                 error;
 } send_buf_t, *psend_buf_t;
@@ -252,11 +293,12 @@ typedef struct
     unsigned int        addr_in;
     unsigned int        addr_in_hi;
     int                 num_burst_bytes;
-    uint8_t             databuf[DATABUF_SIZE];
+    uint8_t             databuf[DATABUF_BANKS][DATABUF_SIZE];
     int                 status;
     int                 count;
     int                 countsec;
     unsigned int        interrupt;
+    int                 ticks_remaining;
 } rcv_buf_t, *prcv_buf_t;
 
 
@@ -268,14 +310,32 @@ typedef int  (*pVUserInt_t)      (int);
 
 typedef struct
 {
-    sem_t               snd;
-    sem_t               rcv;
+    vsync_t             snd;
+    vsync_t             rcv;
+    vco_t               co;
+    bool                dispatched;
+    int                 pool_worker;
+    bool                read_poll;
     send_buf_t          send_buf;
     rcv_buf_t           rcv_buf;
     pVUserInt_t         VIntVecCB;
     unsigned int        last_int;
+    virq_queue_t        irq;
+    int                 tick_count;
+    std::atomic<uint64_t> vtrans_calls;
+    vqueue_t            queue;
+    vcache_t            cache;
+#if !defined(GHDL)
+    std::mutex          acc_mx;
+#endif
+#if defined(VP_NUMA)
+    int                 numa_node;
+#endif
+#if defined(VP_PERF_COUNTERS)
+    vperf_t             perf;
+#endif
 } SchedState_t, *pSchedState_t;
 
-extern pSchedState_t ns[VP_MAX_NODES];
+extern VNodeReg<SchedState_t> ns;
 
 #endif
@@ -0,0 +1,281 @@
+// =========================================================================
+//
+//  File Name:         OsvvmVQueue.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Per node transaction submission and completion queues. Each is a
+//      single producer, single consumer lock free ring. Transactions are
+//      submitted by the user thread and drained, in a single VTrans
+//      call, by the simulator, which returns tagged completions.
+//      Batched transactions return their read data directly to the
+//      caller's records instead. Read futures have their read address
+//      phases queued, with their read data fetched by the simulator, as
+//      it becomes available, whenever the queue is drained.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Read future ready check mark
+//    10/2026   ????.??    Ring size as a template parameter
+//    10/2026   ????.??    Count of queued transactions awaiting completion
+//    10/2026   ????.??    Added batched transactions and read futures
+//    10/2026   ????.??    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_VQUEUE_H_
+#define _OSVVM_VQUEUE_H_
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+// -------------------------------------------------------------------------
+// DEFINES AND MACROS
+// -------------------------------------------------------------------------
+
+// Number of entries in each queue (must be a power of 2)
+#ifndef VP_QUEUE_SIZE
+#define VP_QUEUE_SIZE           256
+#endif
+
+// Number of outstanding read futures per node (must be a power of 2)
+#ifndef VP_FUTURE_SIZE
+#define VP_FUTURE_SIZE          256
+#endif
+
+// -------------------------------------------------------------------------
+// TYPEDEFS
+// -------------------------------------------------------------------------
+
+// Submitted transaction
+typedef struct
+{
+    uint32_t              tag;
+    int                   op;
+    uint64_t              addr;
+    uint64_t              data;
+    int                   addr_width;
+    int                   data_width;
+    int                   prot;
+    bool                  batch;      // Batched transaction, with no completion
+    uint64_t*             rdata;      // Batched read data destination, or NULL
+} vqueue_trans_t;
+
+// Completed transaction, with any read data and status
+typedef struct
+{
+    uint32_t              tag;
+    uint64_t              data;
+    int                   status;
+} vqueue_resp_t;
+
+// Batched transaction record, with read data returned in place
+typedef struct
+{
+    uint64_t              addr;
+    uint64_t              data;
+    int                   addr_width; // 32 or 64
+    int                   data_width; // 8, 16, 32 or 64
+    int                   prot;
+} vbatch_trans_t;
+
+// Single producer, single consumer ring of N entries (a power of 2),
+// VP_QUEUE_SIZE by default. The indexes are free running, and each is
+// only written by one side.
+template <typename T, uint32_t N = VP_QUEUE_SIZE> struct vqueue_ring_t
+{
+    alignas(64) std::atomic<uint32_t> head;   // Written by the producer
+    alignas(64) std::atomic<uint32_t> tail;   // Written by the consumer
+    T                                 entry[N];
+};
+
+// Read futures, numbered by a free running count of those issued. The
+// read data of the futures from completed up to issued is fetched, in
+// order, by the simulator. Those up to wait_until are waited for.
+typedef struct
+{
+    uint32_t              issued;
+    uint32_t              completed;
+    uint32_t              wait_until;
+    uint32_t              ready_mark; // Completed count at the last ready check
+    bool                  stop;       // Read data not available, so stop fetching until the next drain
+    uint64_t              data[VP_FUTURE_SIZE];
+    int                   width[VP_FUTURE_SIZE];
+} vfuture_t;
+
+// A node's submission and completion queues
+typedef struct
+{
+    vqueue_ring_t<vqueue_trans_t> sq;
+    vqueue_ring_t<vqueue_resp_t>  cq;
+    uint32_t                      cur_tag;    // Tag of transaction being processed by the simulator
+    bool                          cur_batch;  // Transaction being processed is batched
+    uint64_t*                     cur_rdata;  // Read data destination of a batched transaction being processed
+    int                           cur_width;  // Data width of a batched transaction being processed
+    bool                          cur_future; // Transaction being processed is a read future's read data phase
+    bool                          pending;    // User message held back whilst the queue is drained
+    uint32_t                      inflight;   // Queued transactions with completions not yet fetched, user side only
+    vfuture_t                     fut;
+} vqueue_t;
+
+// -------------------------------------------------------------------------
+// FUNCTION DEFINITIONS
+// -------------------------------------------------------------------------
+
+// -------------------------------------------------------------------------
+// VQueueInit()
+//
+// Initialise a node's queues to empty
+//
+// -------------------------------------------------------------------------
+
+static inline void VQueueInit (vqueue_t* q)
+{
+    q->sq.head.store(0);
+    q->sq.tail.store(0);
+    q->cq.head.store(0);
+    q->cq.tail.store(0);
+    q->cur_tag        = 0;
+    q->cur_batch      = false;
+    q->cur_rdata      = NULL;
+    q->cur_width      = 0;
+    q->cur_future     = false;
+    q->pending        = false;
+    q->inflight       = 0;
+
+    q->fut.issued     = 0;
+    q->fut.completed  = 0;
+    q->fut.wait_until = 0;
+    q->fut.ready_mark = 0;
+    q->fut.stop       = false;
+}
+
+// -------------------------------------------------------------------------
+// VQueueCount()
+//
+// Number of entries in a ring
+//
+// -------------------------------------------------------------------------
+
+template <typename T, uint32_t N> static inline uint32_t VQueueCount (vqueue_ring_t<T, N>* r)
+{
+    return r->head.load(std::memory_order_acquire) - r->tail.load(std::memory_order_acquire);
+}
+
+// -------------------------------------------------------------------------
+// VQueuePush()
+//
+// Producer side push of an entry to a ring. Returns false if full.
+//
+// -------------------------------------------------------------------------
+
+template <typename T, uint32_t N> static inline bool VQueuePush (vqueue_ring_t<T, N>* r, const T &entry)
+{
+    uint32_t head = r->head.load(std::memory_order_relaxed);
+
+    if (head - r->tail.load(std::memory_order_acquire) == N)
+    {
+        return false;
+    }
+
+    r->entry[head & (N-1)] = entry;
+    r->head.store(head + 1, std::memory_order_release);
+
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// VFutureOutstanding()
+//
+// Returns true if any read futures are awaiting their read data
+//
+// -------------------------------------------------------------------------
+
+static inline bool VFutureOutstanding (vfuture_t* f)
+{
+    return f->completed != f->issued;
+}
+
+// -------------------------------------------------------------------------
+// VFutureWaited()
+//
+// Returns true if the oldest outstanding read future is being waited for
+//
+// -------------------------------------------------------------------------
+
+static inline bool VFutureWaited (vfuture_t* f)
+{
+    return (int32_t)(f->wait_until - f->completed) > 0;
+}
+
+// -------------------------------------------------------------------------
+// VQueueFront()
+//
+// Consumer side access to the oldest entry of a ring, without removing
+// it. Returns NULL if empty.
+//
+// -------------------------------------------------------------------------
+
+template <typename T, uint32_t N> static inline T* VQueueFront (vqueue_ring_t<T, N>* r)
+{
+    uint32_t tail = r->tail.load(std::memory_order_relaxed);
+
+    if (r->head.load(std::memory_order_acquire) == tail)
+    {
+        return NULL;
+    }
+
+    return &r->entry[tail & (N-1)];
+}
+
+// -------------------------------------------------------------------------
+// VQueuePop()
+//
+// Consumer side pop of an entry from a ring. Returns false if empty.
+//
+// -------------------------------------------------------------------------
+
+template <typename T, uint32_t N> static inline bool VQueuePop (vqueue_ring_t<T, N>* r, T* entry)
+{
+    uint32_t tail = r->tail.load(std::memory_order_relaxed);
+
+    if (r->head.load(std::memory_order_acquire) == tail)
+    {
+        return false;
+    }
+
+    *entry = r->entry[tail & (N-1)];
+    r->tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+#endif
@@ -15,6 +15,25 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   ????.??    Adding word based burst buffer access procedures,
+//                         selectable spin-then-sleep node handshake,
+//                         multi-tick wait count down, double banked
+//                         burst data buffers, coroutine handshake,
+//                         transaction submission queue, optional
+//                         performance counters, transaction trace
+//                         recorder, growable node registry, worker
+//                         pool handshake, buffered logging, optional
+//                         cached VHPI parameter handles, batched queue
+//                         transactions, read futures, user side read
+//                         cache and VIrqVec interrupt event queue
+//    10/2026   ????.??    Interrupt event queue overflow reported with event counts
+//                         and times
+//    10/2026   ????.??    User messages only held back for outstanding read
+//                         futures if they read data
+//    10/2026   ????.??    VTrans sends trans32_dword transactions
+//    10/2026   ????.??    VHPI parameter handles optionally cached per
+//                         foreign procedure
+//    10/2026   ????.??    Pool mode per delta cycle collection barrier
 //    07/2025   ????.??    Adding VIrqVec CoSIm procedure
 //    05/2023   2023.05    Adding support for asynchronous transactions
 //                         and address bus responder transactions
@@ -44,17 +63,437 @@
 #include <stdint.h>
 #include <errno.h>
 #include <unistd.h>
+#include <string.h>
+#include <new>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#endif
+#if defined(VP_NUMA)
+#include <numa.h>
+#endif
 #include "OsvvmVProc.h"
 #include "OsvvmVUser.h"
 #include "OsvvmVSchedPli.h"
 
-// Pointers to state for each node (up to VP_MAX_NODES)
-pSchedState_t ns[VP_MAX_NODES] = { NULL };
+// Registry of the state for each node (up to VP_MAX_NODES)
+VNodeReg<SchedState_t> ns;
+
+// Node handshake configuration. Spin, coroutine or pool mode is the
+// default when compiled with VP_SPIN_HANDSHAKE, VP_COROUTINE_HANDSHAKE
+// or VP_POOL_HANDSHAKE defined, and all can be overridden from the
+// environment at the first VInit call.
+#if defined(VP_SPIN_HANDSHAKE)
+vp_handshake_t vp_handshake_mode = VP_HANDSHAKE_SPIN;
+#elif defined(VP_COROUTINE_HANDSHAKE)
+vp_handshake_t vp_handshake_mode = VP_HANDSHAKE_COROUTINE;
+#elif defined(VP_POOL_HANDSHAKE)
+vp_handshake_t vp_handshake_mode = VP_HANDSHAKE_POOL;
+#else
+vp_handshake_t vp_handshake_mode = VP_HANDSHAKE_SEM;
+#endif
+int            vp_spin_count     = VP_DEFAULT_SPIN_COUNT;
+size_t         vp_stack_size     = VP_DEFAULT_STACK_SIZE;
+int            vp_pool_threads   = VP_DEFAULT_POOL_THREADS;
+
+// A pool mode worker thread's run queue of the nodes dispatched to it by
+// VTrans. Each node is always dispatched to the same worker, so that its
+// coroutine only ever runs on one thread.
+typedef struct vpool_worker_s
+{
+    std::mutex              mx;
+    std::condition_variable cv;
+    std::deque<int>         ready;
+} vpool_worker_t;
+
+// The pool of worker threads. The simulator waits, once per delta cycle,
+// for all the dispatched nodes to yield.
+typedef struct vpool_s
+{
+    vpool_worker_t*         workers;
+    std::mutex              mx;
+    std::condition_variable done_cv;
+    int                     busy;       // Nodes dispatched and not yet yielded
+} vpool_t;
+
+static vpool_t vp_pool;
+
+// Transaction trace recorder state, enabled from the environment at the
+// first VInit call
+vtrace_t       vp_trace          = { NULL, NULL, 0 };
+
+// -------------------------------------------------------------------------
+// VConfigHandshake()
+//
+// Select the node handshake mode and spin count from the environment,
+// if set. Must be called before any node is initialised, as all nodes
+// must use the same mode.
+//
+// -------------------------------------------------------------------------
+
+static void VConfigHandshake (void)
+{
+    const char* mode  = getenv(VP_HANDSHAKE_ENV);
+    const char* count = getenv(VP_SPIN_COUNT_ENV);
+    const char* stack = getenv(VP_STACK_SIZE_ENV);
+    const char* pool  = getenv(VP_POOL_THREADS_ENV);
+
+    if (mode != NULL)
+    {
+        if (strcasecmp(mode, "SPIN") == 0)
+        {
+            vp_handshake_mode = VP_HANDSHAKE_SPIN;
+        }
+        else if (strcasecmp(mode, "SEM") == 0)
+        {
+            vp_handshake_mode = VP_HANDSHAKE_SEM;
+        }
+        else if (strcasecmp(mode, "COROUTINE") == 0)
+        {
+            vp_handshake_mode = VP_HANDSHAKE_COROUTINE;
+        }
+        else if (strcasecmp(mode, "POOL") == 0)
+        {
+            vp_handshake_mode = VP_HANDSHAKE_POOL;
+        }
+        else
+        {
+            VPrint("***Warning: VInit() ignoring unrecognised %s value \"%s\"\n", VP_HANDSHAKE_ENV, mode);
+        }
+    }
+
+    if (count != NULL)
+    {
+        vp_spin_count = atoi(count);
+    }
+#if !defined(_WIN32)
+    // Spinning cannot succeed when the other thread can't run at the same
+    // time, so go straight to sleeping on a single processor
+    else if (sysconf(_SC_NPROCESSORS_ONLN) == 1)
+    {
+        vp_spin_count = 0;
+    }
+#endif
+
+    if (stack != NULL && strtoul(stack, NULL, 0) > 2*VP_STACK_GUARD_SIZE)
+    {
+        vp_stack_size = strtoul(stack, NULL, 0);
+    }
+
+    if (pool != NULL && atoi(pool) > 0)
+    {
+        vp_pool_threads = atoi(pool);
+    }
+
+#if !defined(VP_HAVE_COROUTINE)
+    if (VSyncIsCoroutine())
+    {
+        VPrint("***Warning: VInit() coroutine and pool handshakes not supported in this build. Using SEM\n");
+        vp_handshake_mode = VP_HANDSHAKE_SEM;
+    }
+#endif
+
+    DebugVPrint("VConfigHandshake(): mode=%s spin count=%d\n", vp_handshake_mode == VP_HANDSHAKE_SPIN      ? "SPIN"      :
+                                                               vp_handshake_mode == VP_HANDSHAKE_COROUTINE ? "COROUTINE" :
+                                                               vp_handshake_mode == VP_HANDSHAKE_POOL      ? "POOL"      :
+                                                                                                              "SEM",
+                                                               vp_spin_count);
+}
+
+#if defined(VP_HAVE_COROUTINE)
+
+// -------------------------------------------------------------------------
+// VPoolWorker()
+//
+// Pool worker thread, taking dispatched nodes from its run queue and
+// resuming their coroutines until they next yield with a message for
+// the simulator, which is then flagged on the node's snd handshake
+//
+// -------------------------------------------------------------------------
+
+static void* VPoolWorker (void* arg)
+{
+    vpool_worker_t* w = (vpool_worker_t*)arg;
+
+    while (true)
+    {
+        int node;
+
+        {
+            std::unique_lock<std::mutex> lock(w->mx);
+
+            w->cv.wait(lock, [w] {return !w->ready.empty();});
+
+            node = w->ready.front();
+            w->ready.pop_front();
+        }
+
+        DebugVPrint("VPoolWorker(): worker %d resuming node %d coroutine\n", (int)(w - vp_pool.workers), node);
+
+        VLogSetNode(node);
+
+        if (VCoResume(&(ns[node]->co)) == -1)
+        {
+            VPrint("***Error: VPoolWorker() failed to resume node %d coroutine\n", node);
+            exit(VP_SYSCALL_ERR);
+        }
+
+        VLogSetNode(-1);
+
+        VSyncPost(&(ns[node]->snd));
+
+        {
+            std::lock_guard<std::mutex> lock(vp_pool.mx);
+
+            if (--vp_pool.busy == 0)
+            {
+                vp_pool.done_cv.notify_all();
+            }
+        }
+    }
+
+    return NULL;
+}
+
+// -------------------------------------------------------------------------
+// VPoolStart()
+//
+// Start the pool of worker threads, in pool mode
+//
+// -------------------------------------------------------------------------
+
+static void VPoolStart (void)
+{
+    pthread_t thread;
+
+    vp_pool.workers = new vpool_worker_t[vp_pool_threads];
+    vp_pool.busy    = 0;
+
+    for (int idx = 0; idx < vp_pool_threads; idx++)
+    {
+        if (pthread_create(&thread, NULL, VPoolWorker, &vp_pool.workers[idx]) != 0)
+        {
+            VPrint("***Error: VInit() failed to start pool worker thread %d\n", idx);
+            exit(VP_SYSCALL_ERR);
+        }
+
+        pthread_detach(thread);
+    }
+
+    DebugVPrint("VPoolStart(): started %d pool worker threads\n", vp_pool_threads);
+}
+
+// -------------------------------------------------------------------------
+// VPoolDispatch()
+//
+// Queue a node's coroutine to be resumed by its pool worker, without
+// waiting for it to yield. VTrans returns POOL_COLLECT to the simulator,
+// which calls VTrans again, after a delta cycle, to collect the node's
+// message, so that all the nodes dispatched in a delta cycle run
+// concurrently across the workers.
+//
+// -------------------------------------------------------------------------
+
+static void VPoolDispatch (const int node)
+{
+    vpool_worker_t* w = &vp_pool.workers[ns[node]->pool_worker];
+
+    ns[node]->dispatched = true;
+
+    {
+        std::lock_guard<std::mutex> lock(vp_pool.mx);
+
+        vp_pool.busy++;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(w->mx);
+
+        w->ready.push_back(node);
+    }
+
+    w->cv.notify_one();
+}
+
+#endif
+
+// -------------------------------------------------------------------------
+// VPoolCollect()
+//
+// If a node was dispatched to a pool worker by its last VTrans call,
+// collect its next message. The first collection of a delta cycle waits
+// for all the nodes dispatched to yield, with the rest then collected
+// without waiting. Returns true if the node was collected.
+//
+// -------------------------------------------------------------------------
+
+static inline bool VPoolCollect (const int node)
+{
+    if (!ns[node]->dispatched)
+    {
+        return false;
+    }
+
+    DebugVPrint("VTrans(): collecting node %d from pool\n", node);
+
+    {
+        std::unique_lock<std::mutex> lock(vp_pool.mx);
+
+        vp_pool.done_cv.wait(lock, [] {return vp_pool.busy == 0;});
+    }
+
+    VSyncWait(&(ns[node]->snd));
+
+    ns[node]->dispatched = false;
+
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// VTraceInit()
+//
+// Enable the transaction trace recorder if OSVVM_COSIM_TRACE names a
+// trace file, creating the file and memory mapping its ring buffer.
+//
+// -------------------------------------------------------------------------
+
+void VTraceInit (void)
+{
+    static_assert(sizeof(vtrace_hdr_t) == 64, "trace header must be 64 bytes");
+    static_assert(sizeof(vtrace_rec_t) == 56, "trace record must be 56 bytes");
+
+    const char* fname = getenv(VP_TRACE_ENV);
+    const char* recs  = getenv(VP_TRACE_RECS_ENV);
+    uint64_t    num   = VP_TRACE_DEFAULT_RECS;
+
+    if (fname == NULL || fname[0] == '\0')
+    {
+        return;
+    }
+
+#if defined(_WIN32)
+    VPrint("***Warning: VInit() transaction tracing not supported on Windows. Ignoring %s\n", VP_TRACE_ENV);
+#else
+    // Round the number of records up to a power of 2
+    if (recs != NULL && strtoull(recs, NULL, 0) > 0)
+    {
+        uint64_t req = strtoull(recs, NULL, 0);
+
+        for (num = 1; num < req; num <<= 1);
+    }
+
+    size_t size = sizeof(vtrace_hdr_t) + num * sizeof(vtrace_rec_t);
+    int    fd   = open(fname, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    if (fd == -1 || ftruncate(fd, size) == -1)
+    {
+        VPrint("***Warning: VInit() failed to create trace file %s (%s). Tracing disabled\n", fname, strerror(errno));
+        if (fd != -1)
+        {
+            close(fd);
+        }
+        return;
+    }
+
+    void* mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    // The mapping remains valid after closing the file
+    close(fd);
+
+    if (mem == MAP_FAILED)
+    {
+        VPrint("***Warning: VInit() failed to map trace file %s (%s). Tracing disabled\n", fname, strerror(errno));
+        return;
+    }
+
+    vtrace_hdr_t* hdr = (vtrace_hdr_t*)mem;
+
+    memcpy(hdr->magic, VP_TRACE_MAGIC, sizeof(hdr->magic));
+    hdr->version      = VP_TRACE_VERSION;
+    hdr->rec_size     = sizeof(vtrace_rec_t);
+    hdr->num_recs     = num;
+    hdr->head.store(0);
+
+    vp_trace.hdr      = hdr;
+    vp_trace.recs     = (vtrace_rec_t*)(hdr + 1);
+    vp_trace.mask     = num - 1;
+
+    VPrint("VInit(): tracing transactions to %s (%llu records)\n", fname, (unsigned long long)num);
+#endif
+}
+
+// -------------------------------------------------------------------------
+// VTransIsBurst()
+//
+// Returns true if the transaction type is a burst
+//
+// -------------------------------------------------------------------------
+
+static inline bool VTransIsBurst (const trans_type_e type)
+{
+    return type == trans32_burst || type == trans64_burst || type == stream_snd_burst || type == stream_get_burst;
+}
+
+// -------------------------------------------------------------------------
+// VAllocNodeState()
+//
+// Allocate state for a node, aligned for its cache line aligned members.
+// When compiled with VP_NUMA defined (and linked with -lnuma), the
+// state is allocated on the NUMA node of the calling simulator thread,
+// with the node's user thread then run on that NUMA node.
+//
+// -------------------------------------------------------------------------
+
+static pSchedState_t VAllocNodeState (void)
+{
+    void* mem;
+
+#if defined(VP_NUMA)
+    int numa_node = -1;
+
+    if (numa_available() != -1)
+    {
+        numa_node = numa_node_of_cpu(sched_getcpu());
+    }
+
+    // Page aligned, so also cache line aligned
+    mem = numa_node >= 0 ? numa_alloc_onnode(sizeof(SchedState_t), numa_node) : NULL;
+
+    if (mem == NULL && posix_memalign(&mem, alignof(SchedState_t), sizeof(SchedState_t)) != 0)
+    {
+        mem = NULL;
+    }
+#elif defined(_WIN32)
+    mem = _aligned_malloc(sizeof(SchedState_t), alignof(SchedState_t));
+#else
+    if (posix_memalign(&mem, alignof(SchedState_t), sizeof(SchedState_t)) != 0)
+    {
+        mem = NULL;
+    }
+#endif
+
+    if (mem == NULL)
+    {
+        VPrint("***Error: VInit() failed to allocate node state\n");
+        exit(VP_SYSCALL_ERR);
+    }
+
+    pSchedState_t state = new (mem) SchedState_t;
+
+#if defined(VP_NUMA)
+    state->numa_node = numa_node;
+#endif
+
+    return state;
+}
 
 #if defined(ALDEC)
 
 #include <vhpi_user.h>
 #include <aldecpli.h>
+#include <vector>
 
 // -------------------------------------------------------------------------
 // Function setting up table of foreign procedure registration data
@@ -69,6 +508,10 @@ VPROC_RTN_TYPE reg_foreign_procs() {
         {vhpiProcF, (char*)"VProc", (char*)"VTrans",          NULL, VTrans},
         {vhpiProcF, (char*)"VProc", (char*)"VSetBurstRdByte", NULL, VSetBurstRdByte},
         {vhpiProcF, (char*)"VProc", (char*)"VGetBurstWrByte", NULL, VGetBurstWrByte},
+        {vhpiProcF, (char*)"VProc", (char*)"VSetBurstRdWord", NULL, VSetBurstRdWord},
+        {vhpiProcF, (char*)"VProc", (char*)"VGetBurstWrWord", NULL, VGetBurstWrWord},
+        {vhpiProcF, (char*)"VProc", (char*)"VGetQueueTrans",  NULL, VGetQueueTrans},
+        {vhpiProcF, (char*)"VProc", (char*)"VPutQueueResp",   NULL, VPutQueueResp},
         {(vhpiForeignT) 0}
     };
 
@@ -90,60 +533,112 @@ VPROC_RTN_TYPE (*vhpi_startup_routines[])() = {
     0L
 };
 
+typedef std::vector<vhpiHandleT> vhpi_params_t;
+
+// Foreign procedures, indexing their parameter handles
+typedef enum vhpi_proc_e
+{
+    VHPI_VINIT,
+    VHPI_VIRQVEC,
+    VHPI_VTRANS,
+    VHPI_VSETBURSTRDBYTE,
+    VHPI_VGETBURSTWRBYTE,
+    VHPI_VSETBURSTRDWORD,
+    VHPI_VGETBURSTWRWORD,
+    VHPI_VGETQUEUETRANS,
+    VHPI_VPUTQUEUERESP,
+    VHPI_NUM_PROCS
+} vhpi_proc_t;
+
+// Parameter declaration handles of each foreign procedure, collected on
+// every call. With VP_VHPI_CACHE defined, those of a procedure's first
+// call are kept and reused for all its later calls, from every node.
+// This relies on the handles referring to whichever call is being
+// executed, which is not yet verified under Riviera-PRO, so is off by
+// default.
+static vhpi_params_t vhpi_param_cache[VHPI_NUM_PROCS];
+
 // -------------------------------------------------------------------------
-// getVhpiParams()
+// getVhpiHandles()
 //
-// Get the parameter values of a foreign procedure using VHPI methods
+// Get the parameter declaration handles of a foreign procedure call,
+// iterating over its parameters, or, if cached, only on the procedure's
+// first call. Called only from the simulator's thread.
 //
 // -------------------------------------------------------------------------
 
-static void getVhpiParams(const struct vhpiCbDataS* cb, int args[], int args_size)
+static const vhpi_params_t* getVhpiHandles(const struct vhpiCbDataS* cb, const vhpi_proc_t proc, int args_size)
 {
-    int         idx      = 0;
-    vhpiValueT  value;
+    vhpi_params_t* params = &vhpi_param_cache[proc];
+
+#if defined(VP_VHPI_CACHE)
+    if ((int)params->size() == args_size)
+    {
+        return params;
+    }
+#endif
 
     vhpiHandleT hParam;
-    vhpiHandleT hScope   = cb->obj;
-    vhpiHandleT hIter    = vhpi_iterator(vhpiParamDecls, hScope);
+    vhpiHandleT hIter = vhpi_iterator(vhpiParamDecls, cb->obj);
+
+    params->clear();
+
+    while ((int)params->size() < args_size && (hParam = vhpi_scan(hIter)))
+    {
+        params->push_back(hParam);
+    }
+
+    // The iterator is only released by the scan when it reaches the end
+    if ((int)params->size() == args_size)
+    {
+        vhpi_release_handle(hIter);
+    }
+
+    return params;
+}
+
+// -------------------------------------------------------------------------
+// getVhpiParams()
+//
+// Get the parameter values of a foreign procedure using VHPI methods
+//
+// -------------------------------------------------------------------------
 
-    while ((hParam = vhpi_scan(hIter)) && idx < args_size)
+static void getVhpiParams(const struct vhpiCbDataS* cb, const vhpi_proc_t proc, int args[], int args_size)
+{
+    vhpiValueT           value;
+    const vhpi_params_t* params = getVhpiHandles(cb, proc, args_size);
+
+    for (int idx = 0; idx < (int)params->size(); idx++)
     {
         value.format     = vhpiIntVal;
         value.bufSize    = 0;
         value.value.intg = 0;
-        vhpi_get_value(hParam, &value);
-        args[idx++]      = value.value.intg;
-        DebugVPrint("getVhpiParams(): %s = %d\n", vhpi_get_str(vhpiNameP, hParam), value.value.intg);
+        vhpi_get_value((*params)[idx], &value);
+        args[idx]        = value.value.intg;
+        DebugVPrint("getVhpiParams(): %s = %d\n", vhpi_get_str(vhpiNameP, (*params)[idx]), value.value.intg);
     }
 }
 
 // -------------------------------------------------------------------------
 // setVhpiParams()
 //
-// Set the parameters values of a foreign procedure using VHPI methods
+// Set the output parameter values of a foreign procedure using VHPI methods
 //
 // -------------------------------------------------------------------------
 
-static void setVhpiParams(const struct vhpiCbDataS* cb, int args[], int start_of_outputs, int args_size)
+static void setVhpiParams(const struct vhpiCbDataS* cb, const vhpi_proc_t proc, int args[], int start_of_outputs, int args_size)
 {
-    int         idx      = 0;
-    vhpiValueT  value;
-
-    vhpiHandleT hParam;
-    vhpiHandleT hScope   = cb->obj;
-    vhpiHandleT hIter    = vhpi_iterator(vhpiParamDecls, hScope);
+    vhpiValueT           value;
+    const vhpi_params_t* params = getVhpiHandles(cb, proc, args_size);
 
-    while ((hParam = vhpi_scan(hIter)) && idx < args_size)
+    for (int idx = start_of_outputs; idx < (int)params->size(); idx++)
     {
-        if (idx >= start_of_outputs)
-        {
-            DebugVPrint("setVhpiParams(): %s = %d\n", vhpi_get_str(vhpiNameP, hParam), args[idx]);
-            value.format     = vhpiIntVal;
-            value.bufSize    = 0;
-            value.value.intg = args[idx];
-            vhpi_put_value(hParam, &value, vhpiDeposit);
-        }
-        idx++;
+        DebugVPrint("setVhpiParams(): %s = %d\n", vhpi_get_str(vhpiNameP, (*params)[idx]), args[idx]);
+        value.format     = vhpiIntVal;
+        value.bufSize    = 0;
+        value.value.intg = args[idx];
+        vhpi_put_value((*params)[idx], &value, vhpiDeposit);
     }
 }
 #endif
@@ -161,12 +656,28 @@ VPROC_RTN_TYPE VInit (VINIT_PARAMS)
 
     setvbuf(stdout, 0, _IONBF, 0);
 
-    getVhpiParams(cb, args, VINIT_NUM_ARGS);
+    getVhpiParams(cb, VHPI_VINIT, args, VINIT_NUM_ARGS);
     node = args[0];
 #endif
 
+    static bool configured = false;
+
     VPrint("VInit(%d)\n", node);
 
+    if (!configured)
+    {
+        VLogInit();
+        VConfigHandshake();
+        VTraceInit();
+#if defined(VP_HAVE_COROUTINE)
+        if (vp_handshake_mode == VP_HANDSHAKE_POOL)
+        {
+            VPoolStart();
+        }
+#endif
+        configured = true;
+    }
+
     // Range check node number
     if (node < 0 || node >= VP_MAX_NODES)
     {
@@ -176,29 +687,139 @@ VPROC_RTN_TYPE VInit (VINIT_PARAMS)
 
     DebugVPrint("VInit(): node = %d\n", node);
 
-    // Allocate some space for the node state and update pointer
-    ns[node] = (pSchedState_t) malloc(sizeof(SchedState_t));
-
-    // Set up semaphores for this node
-    DebugVPrint("VInit(): initialising semaphores for node %d\n", node);
-
-    if (sem_init(&(ns[node]->snd), 0, 0) == -1)
+    // Allocate some space for the node state
+    pSchedState_t state = VAllocNodeState();
+    state->tick_count   = 0;
+    state->vtrans_calls = 0;
+    state->dispatched   = false;
+    state->pool_worker  = node % vp_pool_threads;
+    state->read_poll    = false;
+    VQueueInit(&(state->queue));
+    VCacheInit(&(state->cache));
+    VIrqInit(&(state->irq));
+    VPERF_INIT(state->perf);
+
+    // Set up handshakes for this node
+    DebugVPrint("VInit(): initialising handshakes for node %d\n", node);
+
+    if (VSyncInit(&(state->snd)) == -1)
     {
         VPrint("***Error: VInit() failed to initialise semaphore\n");
         exit(1);
     }
-    if (sem_init(&(ns[node]->rcv), 0, 0) == -1)
+    if (VSyncInit(&(state->rcv)) == -1)
     {
         VPrint("***Error: VInit() failed to initialise semaphore\n");
         exit(1);
     }
 
-    DebugVPrint("VInit(): initialising semaphores for node %d---Done\n", node);
+    // Register the node state, once initialised
+    ns.set(node, state);
+
+    DebugVPrint("VInit(): initialising handshakes for node %d---Done\n", node);
 
     // Issue a new thread to run the user code
     VUser(node);
 }
 
+// -------------------------------------------------------------------------
+// VTransReadsData()
+//
+// Returns true if an address bus operation consumes read data
+//
+// -------------------------------------------------------------------------
+
+static inline bool VTransReadsData (const int op)
+{
+    switch (op)
+    {
+        case READ_OP:
+        case READ_DATA:
+        case READ_CHECK:
+        case READ_DATA_CHECK:
+        case ASYNC_READ:
+        case ASYNC_READ_DATA:
+        case ASYNC_READ_DATA_CHECK:
+        case WRITE_AND_READ:
+        case ASYNC_WRITE_AND_READ:
+        case READ_BURST:
+        case READ_POLL:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+// -------------------------------------------------------------------------
+// VIrqQueue()
+//
+// Push an interrupt vector event, timestamped with the node's VTrans
+// call count, to the node's interrupt event queue. Events are never
+// dropped, so a full queue, of VP_IRQ_QUEUE_SIZE entries, is an error,
+// reported with the number of events raised and the time of the oldest
+// undrained.
+//
+// -------------------------------------------------------------------------
+
+static void VIrqQueue (const int node, const uint32_t vec)
+{
+    virq_queue_t* q   = &(ns[node]->irq);
+    uint64_t      now = ns[node]->vtrans_calls.load(std::memory_order_relaxed);
+
+    if (!VIrqPush(q, now, vec))
+    {
+        // The oldest undrained event, which the consumer side may be about to pop
+        uint64_t oldest = q->ring.entry[q->ring.tail.load() & (VP_IRQ_QUEUE_SIZE-1)].timestamp;
+
+        VPrint("***Error: node %d interrupt event queue full at VTrans call %llu, with %u events raised and %d undrained, "
+               "the oldest from VTrans call %llu. Drain the events more often, or increase VP_IRQ_QUEUE_SIZE\n",
+               node, (unsigned long long)now, q->ring.head.load() + 1, VP_IRQ_QUEUE_SIZE,
+               (unsigned long long)oldest);
+        exit(VP_QUEUE_ERR);
+    }
+}
+
+// -------------------------------------------------------------------------
+// VTransUserMsg()
+//
+// Account for a new message from the user code in the node's send
+// buffer. Returns true if the message is to be held back whilst the
+// node's submission queue is drained.
+//
+// -------------------------------------------------------------------------
+
+static bool VTransUserMsg (const int node)
+{
+    VPERF_SIM_WAKE(ns[node]->perf);
+    VPERF_COUNT(ns[node]->perf, ns[node]->send_buf.op, ns[node]->send_buf.type,
+                VTransIsBurst(ns[node]->send_buf.type) ? ns[node]->send_buf.num_burst_bytes : 0);
+
+    ns[node]->tick_count = ns[node]->send_buf.tick_count;
+
+    // Any transactions in the node's submission queue are drained before
+    // the user message is sent, so hold back the message. The bus returns
+    // read data in issue order, so all outstanding read futures must also
+    // have their data fetched before a message that reads data.
+    if (ns[node]->send_buf.op != QUEUE_DRAIN)
+    {
+        bool reads = VTransReadsData(ns[node]->send_buf.op) && VFutureOutstanding(&(ns[node]->queue.fut));
+
+        if (reads)
+        {
+            ns[node]->queue.fut.wait_until = ns[node]->queue.fut.issued;
+        }
+
+        if (reads || VQueueCount(&(ns[node]->queue.sq)) > 0)
+        {
+            ns[node]->queue.pending = true;
+            return true;
+        }
+    }
+
+    return false;
+}
+
 // -------------------------------------------------------------------------
 // VTrans
 //
@@ -214,6 +835,7 @@ VPROC_RTN_TYPE VTrans (VTRANS_PARAMS)
     int VPDataOutHi_int, VPAddrHi_int, VPBurstSize_int, VPDone_int;
     int VPDataWidth_int, VPAddrWidth_int;
     int VPError_int,     VPParam_int;
+    bool collected;
 
 #if defined(ALDEC)
     int  args[VTRANS_NUM_ARGS];
@@ -223,7 +845,7 @@ VPROC_RTN_TYPE VTrans (VTRANS_PARAMS)
     int  VPCount;
     int  VPCountSec;
 
-    getVhpiParams(cb, args, VTRANS_NUM_ARGS);
+    getVhpiParams(cb, VHPI_VTRANS, args, VTRANS_NUM_ARGS);
 
     int argIdx           = 0;
     node                 = args[argIdx++];
@@ -232,6 +854,10 @@ VPROC_RTN_TYPE VTrans (VTRANS_PARAMS)
     VPCount              = args[argIdx++];
     VPCountSec           = args[argIdx++];
 
+    // A node dispatched to a pool worker by its last call is collected
+    // before its state is updated
+    collected            = VPoolCollect(node);
+
     VPDataOut_int        = 0; VPDataOut_int  = 0;
     VPDataWidth_int      = 0;
     VPAddr_int           = 0; VPAddrHi_int   = 0;
@@ -244,60 +870,169 @@ VPROC_RTN_TYPE VTrans (VTRANS_PARAMS)
     VPParam_int          = 0;
 
     // Sample data inputs and update node receive state
-    ns[node]->rcv_buf.data_in        = args[argIdx++];
-    ns[node]->rcv_buf.data_in_hi     = args[argIdx++];
+    if (!collected)
+    {
+        ns[node]->rcv_buf.data_in    = args[argIdx++];
+        ns[node]->rcv_buf.data_in_hi = args[argIdx++];
 
-    // Skip over data width output
-    argIdx               += 1;
+        // Skip over data width output
+        argIdx           += 1;
 
-    // Sample address and update node receive state
-    ns[node]->rcv_buf.addr_in        = args[argIdx++];
-    ns[node]->rcv_buf.addr_in_hi     = args[argIdx++];
+        // Sample address and update node receive state
+        ns[node]->rcv_buf.addr_in    = args[argIdx++];
+        ns[node]->rcv_buf.addr_in_hi = args[argIdx++];
+    }
 
 #else
-    // Sample data inputs and update node receive state
-    if (ns[node]->send_buf.type != trans32_burst)
+    // A node dispatched to a pool worker by its last call is collected
+    // before its state is updated
+    collected            = VPoolCollect(node);
+
+    if (!collected)
     {
-        ns[node]->rcv_buf.data_in    = *VPData;
-        ns[node]->rcv_buf.data_in_hi = *VPDataHi;
-    }
+        // Sample data inputs and update node receive state
+        if (ns[node]->send_buf.type != trans32_burst)
+        {
+            ns[node]->rcv_buf.data_in    = *VPData;
+            ns[node]->rcv_buf.data_in_hi = *VPDataHi;
+        }
 
-    // Sample Address and update node receive state
-    ns[node]->rcv_buf.addr_in        = *VPAddr;
-    ns[node]->rcv_buf.addr_in_hi     = *VPAddrHi;
+        // Sample Address and update node receive state
+        ns[node]->rcv_buf.addr_in        = *VPAddr;
+        ns[node]->rcv_buf.addr_in_hi     = *VPAddrHi;
+    }
 #endif
 
-    if (ns[node]->send_buf.type == trans32_burst)
+    // A collecting call's inputs are those already sampled by the call that
+    // dispatched the node, so the node's receive state is left unchanged
+    if (!collected)
+    {
+        if (ns[node]->send_buf.type == trans32_burst)
+        {
+            ns[node]->rcv_buf.num_burst_bytes = ns[node]->send_buf.num_burst_bytes;
+        }
+
+        // Sample other inputs and update node receive state
+        ns[node]->rcv_buf.interrupt  = Interrupt;
+        ns[node]->rcv_buf.status     = VPStatus;
+        ns[node]->rcv_buf.count      = VPCount;
+        ns[node]->rcv_buf.countsec   = VPCountSec;
+
+        // Queue a change of the interrupt vector as an interrupt event, for the
+        // interrupt callback to be called from the same place as for VIrqVec
+        if ((unsigned int)Interrupt != ns[node]->last_int)
+        {
+            VIrqQueue(node, (uint32_t)Interrupt);
+            ns[node]->last_int = Interrupt;
+        }
+
+        // Single writer, so no atomic read-modify-write needed
+        ns[node]->vtrans_calls.store(ns[node]->vtrans_calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    VPERF_VTRANS_ENTRY(ns[node]->perf);
+
+    bool counting   = false;
+    bool draining   = false;
+    bool dispatched = false;
+
+    if (collected)
     {
-        ns[node]->rcv_buf.num_burst_bytes = ns[node]->send_buf.num_burst_bytes;
+        // The user message of a node dispatched to a pool worker by the
+        // last call is now ready
+        draining = VTransUserMsg(node);
     }
+    else if (ns[node]->queue.pending)
+    {
+        // The submission queue has been drained, so now send the user
+        // message held back, without waking the user thread. The user side
+        // only queues transactions with room for their completions, so the
+        // queue is always emptied, and the message never overtakes any.
+        if (VQueueCount(&(ns[node]->queue.sq)) > 0)
+        {
+            VPrint("***Error: VTrans() node %d submission queue blocked on a full completion queue\n", node);
+            exit(VP_QUEUE_ERR);
+        }
 
-    // Sample other inputs and update node receive state
-    ns[node]->rcv_buf.interrupt  = Interrupt;
-    ns[node]->rcv_buf.status     = VPStatus;
-    ns[node]->rcv_buf.count      = VPCount;
-    ns[node]->rcv_buf.countsec   = VPCountSec;
+        ns[node]->queue.pending = false;
+    }
+    // If counting down the ticks of a multi-tick wait, with no interrupt
+    // events to drain, repeat the last single tick wait without waking
+    // the user thread.
+    else if (ns[node]->tick_count > 0 && !VIrqPending(&(ns[node]->irq)))
+    {
+        counting = true;
+        ns[node]->tick_count--;
+    }
+    else
+    {
+        ns[node]->rcv_buf.ticks_remaining = ns[node]->tick_count;
 
-    // Send message to VUser with input values
-    DebugVPrint("VTrans(): setting rcv[%d] semaphore\n", node);
-    sem_post(&(ns[node]->rcv));
+        VPERF_SIM_POST(ns[node]->perf);
 
-    // Wait for a message from VUser process with output data
-    DebugVPrint("VTrans(): waiting for snd[%d] semaphore\n", node);
-    sem_wait(&(ns[node]->snd));
+#if defined(VP_HAVE_COROUTINE)
+        if (vp_handshake_mode == VP_HANDSHAKE_COROUTINE)
+        {
+            // Switch to the user code with input values, returning with output data
+            DebugVPrint("VTrans(): resuming node %d coroutine\n", node);
+            VLogSetNode(node);
+            if (VCoResume(&(ns[node]->co)) == -1)
+            {
+                VPrint("***Error: VTrans() failed to resume node %d coroutine\n", node);
+                exit(VP_SYSCALL_ERR);
+            }
+            VLogSetNode(-1);
+        }
+        else if (vp_handshake_mode == VP_HANDSHAKE_POOL)
+        {
+            // Resume the user code on a pool worker, returning POOL_COLLECT
+            // for its message to be collected by the next call
+            DebugVPrint("VTrans(): dispatching node %d coroutine to pool\n", node);
+            VPoolDispatch(node);
+            dispatched = true;
+        }
+        else
+#endif
+        {
+            // Send message to VUser with input values
+            DebugVPrint("VTrans(): setting rcv[%d] semaphore\n", node);
+            VSyncPost(&(ns[node]->rcv));
+
+            // Wait for a message from VUser process with output data
+            DebugVPrint("VTrans(): waiting for snd[%d] semaphore\n", node);
+            VSyncWait(&(ns[node]->snd));
+        }
+
+        if (!dispatched)
+        {
+            draining = VTransUserMsg(node);
+        }
+    }
 
     // Update outputs of VTrans procedure
-    if (ns[node]->send_buf.ticks >= DELTA_CYCLE)
+    if (dispatched || draining)
+    {
+        VPDataOut_int   = 0; VPDataOutHi_int = 0;
+        VPAddr_int      = 0; VPAddrHi_int    = 0;
+        VPDataWidth_int = 0; VPAddrWidth_int = 0;
+        VPOp_int        = dispatched ? POOL_COLLECT : QUEUE_DRAIN;
+        VPBurstSize_int = 0;
+        VPTicks_int     = 0;
+        VPDone_int      = 0;
+        VPError_int     = 0;
+        VPParam_int     = 0;
+    }
+    else if (ns[node]->send_buf.ticks >= DELTA_CYCLE)
     {
         VPDataOut_int   = ((uint32_t*)ns[node]->send_buf.data)[0];
-        VPDataOutHi_int = ((uint32_t*)ns[node]->send_buf.data)[4];
+        VPDataOutHi_int = ((uint32_t*)ns[node]->send_buf.data)[1];
         VPAddr_int      = (uint32_t)((ns[node]->send_buf.addr)       & 0xffffffffULL);
         VPAddrHi_int    = (uint32_t)((ns[node]->send_buf.addr >> 32) & 0xffffffffULL);
         VPOp_int        = ns[node]->send_buf.op;
         VPBurstSize_int = ns[node]->send_buf.num_burst_bytes;
         VPTicks_int     = ns[node]->send_buf.ticks;
-        VPDone_int      = ns[node]->send_buf.done;
-        VPError_int     = ns[node]->send_buf.error;
+        VPDone_int      = counting ? 0 : ns[node]->send_buf.done;
+        VPError_int     = counting ? 0 : ns[node]->send_buf.error;
         VPParam_int     = ns[node]->send_buf.param;
 
         switch(ns[node]->send_buf.type)
@@ -315,6 +1050,10 @@ VPROC_RTN_TYPE VTrans (VTRANS_PARAMS)
                 VPAddrWidth_int = 32;
                 VPDataWidth_int = 32;
                 break;
+            case trans32_dword:
+                VPAddrWidth_int = 32;
+                VPDataWidth_int = 64;
+                break;
             case trans64_byte:
             case stream_snd_byte:
             case stream_get_byte:
@@ -358,6 +1097,20 @@ VPROC_RTN_TYPE VTrans (VTRANS_PARAMS)
 
     DebugVPrint("===> addr=%08x rnw=%d burst=%d ticks=%d\n", VPAddr_int, VPRw_int, VPBurstSize_int, VPTicks_int);
 
+#if defined(VP_PERF_COUNTERS)
+    // Dump the node's performance counters at the end of the simulation
+    if (VPDone_int)
+    {
+        VPerfDump(node);
+    }
+#endif
+
+    // Note a read poll being executed by the simulator, which a VIrqVec
+    // interrupt can end early
+    ns[node]->read_poll = VPOp_int == READ_POLL;
+
+    VPERF_VTRANS_EXIT(ns[node]->perf);
+
 #if !defined(ALDEC)
     // Export outputs over FLI
     *VPData           = VPDataOut_int;
@@ -387,7 +1140,7 @@ VPROC_RTN_TYPE VTrans (VTRANS_PARAMS)
     args[argIdx++]    = VPError_int;
     args[argIdx++]    = VPParam_int;
 
-    setVhpiParams(cb, args, VTRANS_START_OF_OUTPUTS, VTRANS_NUM_ARGS);
+    setVhpiParams(cb, VHPI_VTRANS, args, VTRANS_START_OF_OUTPUTS, VTRANS_NUM_ARGS);
 #endif
 }
 
@@ -401,7 +1154,7 @@ VPROC_RTN_TYPE VSetBurstRdByte(VSETBURSTRDBYTE_PARAMS)
 #if defined(ALDEC)
     int args[VSETBURSTRDBYTE_NUM_ARGS];
 
-    getVhpiParams(cb, args, VSETBURSTRDBYTE_NUM_ARGS);
+    getVhpiParams(cb, VHPI_VSETBURSTRDBYTE, args, VSETBURSTRDBYTE_NUM_ARGS);
 
     int argIdx           = 0;
     int node             = args[argIdx++];
@@ -409,7 +1162,7 @@ VPROC_RTN_TYPE VSetBurstRdByte(VSETBURSTRDBYTE_PARAMS)
     int data             = args[argIdx++];
 #endif
 
-    ns[node]->rcv_buf.databuf[idx % DATABUF_SIZE] = data;
+    ns[node]->rcv_buf.databuf[ns[node]->send_buf.buf_sel][idx % DATABUF_SIZE] = data;
 }
 
 // -------------------------------------------------------------------------
@@ -422,25 +1175,247 @@ VPROC_RTN_TYPE VGetBurstWrByte(VGETBURSTWRBYTE_PARAMS)
 #if defined(ALDEC)
     int args[VGETBURSTWRBYTE_NUM_ARGS];
 
-    getVhpiParams(cb, args, VGETBURSTWRBYTE_NUM_ARGS);
+    getVhpiParams(cb, VHPI_VGETBURSTWRBYTE, args, VGETBURSTWRBYTE_NUM_ARGS);
 
     int argIdx           = 0;
     int node             = args[argIdx++];
     int idx              = args[argIdx++];
 
     argIdx            = VGETBURSTWRBYTE_START_OF_OUTPUTS;
-    args[argIdx++]    = ns[node]->send_buf.databuf[idx % DATABUF_SIZE];;
-    setVhpiParams(cb, args, VGETBURSTWRBYTE_START_OF_OUTPUTS, VGETBURSTWRBYTE_NUM_ARGS);
+    args[argIdx++]    = ns[node]->send_buf.databuf[ns[node]->send_buf.buf_sel][idx % DATABUF_SIZE];;
+    setVhpiParams(cb, VHPI_VGETBURSTWRBYTE, args, VGETBURSTWRBYTE_START_OF_OUTPUTS, VGETBURSTWRBYTE_NUM_ARGS);
 #else
-    *data = ns[node]->send_buf.databuf[idx % DATABUF_SIZE];
+    *data = ns[node]->send_buf.databuf[ns[node]->send_buf.buf_sel][idx % DATABUF_SIZE];
+#endif
+}
+
+// -------------------------------------------------------------------------
+// VSetBurstRdWord()
+//
+// Write a 64-bit word slice (as two 32-bit integers) of burst read data
+// to the receive buffer, starting at byte index idx. Bytes are packed
+// little endian, with byte idx in bits 7:0 of data. Any part of the
+// slice beyond the end of the buffer is discarded.
+//
+// -------------------------------------------------------------------------
+
+VPROC_RTN_TYPE VSetBurstRdWord(VSETBURSTRDWORD_PARAMS)
+{
+#if defined(ALDEC)
+    int args[VSETBURSTRDWORD_NUM_ARGS];
+
+    getVhpiParams(cb, VHPI_VSETBURSTRDWORD, args, VSETBURSTRDWORD_NUM_ARGS);
+
+    int argIdx           = 0;
+    int node             = args[argIdx++];
+    int idx              = args[argIdx++];
+    int data             = args[argIdx++];
+    int datahi           = args[argIdx++];
 #endif
+
+    uint32_t word[2]     = {(uint32_t)data, (uint32_t)datahi};
+    int      offset      = idx % DATABUF_SIZE;
+    int      len         = (DATABUF_SIZE - offset) < (int)sizeof(word) ? (DATABUF_SIZE - offset) : (int)sizeof(word);
+
+    memcpy(&ns[node]->rcv_buf.databuf[ns[node]->send_buf.buf_sel][offset], word, len);
+}
+
+// -------------------------------------------------------------------------
+// VGetBurstWrWord()
+//
+// Fetch a 64-bit word slice (as two 32-bit integers) of burst write data
+// from the send buffer, starting at byte index idx. Bytes are packed
+// little endian, with byte idx in bits 7:0 of data. Any part of the
+// slice beyond the end of the buffer is returned as zero.
+//
+// -------------------------------------------------------------------------
+
+VPROC_RTN_TYPE VGetBurstWrWord(VGETBURSTWRWORD_PARAMS)
+{
+#if defined(ALDEC)
+    int args[VGETBURSTWRWORD_NUM_ARGS];
+
+    getVhpiParams(cb, VHPI_VGETBURSTWRWORD, args, VGETBURSTWRWORD_NUM_ARGS);
+
+    int argIdx           = 0;
+    int node             = args[argIdx++];
+    int idx              = args[argIdx++];
+#endif
+
+    uint32_t word[2]     = {0, 0};
+    int      offset      = idx % DATABUF_SIZE;
+    int      len         = (DATABUF_SIZE - offset) < (int)sizeof(word) ? (DATABUF_SIZE - offset) : (int)sizeof(word);
+
+    memcpy(word, &ns[node]->send_buf.databuf[ns[node]->send_buf.buf_sel][offset], len);
+
+#if defined(ALDEC)
+    argIdx            = VGETBURSTWRWORD_START_OF_OUTPUTS;
+    args[argIdx++]    = (int)word[0];
+    args[argIdx++]    = (int)word[1];
+    setVhpiParams(cb, VHPI_VGETBURSTWRWORD, args, VGETBURSTWRWORD_START_OF_OUTPUTS, VGETBURSTWRWORD_NUM_ARGS);
+#else
+    *data             = (int)word[0];
+    *datahi           = (int)word[1];
+#endif
+}
+
+// -------------------------------------------------------------------------
+// VGetQueueTrans()
+//
+// Fetch the next transaction from the node's submission queue. valid is
+// returned as 0 if the queue is empty, or if the completion queue has
+// no room for the transaction's response. Batched transactions have
+// no completion, so are never held back. Once the queue is empty, the
+// read data phases of any outstanding read futures are returned, in
+// order, blocking for those waited for and otherwise stopping at the
+// first with no data available. The response for a fetched transaction
+// must be returned with VPutQueueResp() before the next is fetched.
+//
+// -------------------------------------------------------------------------
+
+VPROC_RTN_TYPE VGetQueueTrans(VGETQUEUETRANS_PARAMS)
+{
+    vqueue_trans_t  trans;
+    vqueue_trans_t* front;
+    int             valid = 0;
+
+#if defined(ALDEC)
+    int args[VGETQUEUETRANS_NUM_ARGS];
+
+    getVhpiParams(cb, VHPI_VGETQUEUETRANS, args, VGETQUEUETRANS_NUM_ARGS);
+
+    int argIdx           = 0;
+    int node             = args[argIdx++];
+#endif
+
+    vqueue_t* q          = &(ns[node]->queue);
+
+    if ((front = VQueueFront(&q->sq)) != NULL &&
+        (front->batch || VQueueCount(&q->cq) < VP_QUEUE_SIZE) &&
+        VQueuePop(&q->sq, &trans))
+    {
+        q->cur_tag   = trans.tag;
+        q->cur_batch = trans.batch;
+        q->cur_rdata = trans.rdata;
+        q->cur_width = trans.data_width;
+        valid        = 1;
+
+        VPERF_COUNT(ns[node]->perf, trans.op, -1, 0);
+    }
+    else if (front == NULL && VFutureOutstanding(&q->fut) && !q->fut.stop)
+    {
+        memset(&trans, 0, sizeof(trans));
+
+        trans.op         = VFutureWaited(&q->fut) ? READ_DATA : ASYNC_READ_DATA;
+        trans.addr_width = 32;
+        trans.data_width = q->fut.width[q->fut.completed & (VP_FUTURE_SIZE-1)];
+        q->cur_future    = true;
+        valid            = 1;
+    }
+    else
+    {
+        // End of the drain, so read futures are fetched again on the next
+        q->fut.stop = false;
+        memset(&trans, 0, sizeof(trans));
+    }
+
+    DebugVPrint("VGetQueueTrans(): node %d valid=%d tag=%d op=%d\n", node, valid, trans.tag, trans.op);
+
+#if defined(ALDEC)
+    argIdx            = VGETQUEUETRANS_START_OF_OUTPUTS;
+    args[argIdx++]    = trans.op;
+    args[argIdx++]    = (int)(trans.addr & 0xffffffffULL);
+    args[argIdx++]    = (int)(trans.addr >> 32);
+    args[argIdx++]    = trans.addr_width;
+    args[argIdx++]    = (int)(trans.data & 0xffffffffULL);
+    args[argIdx++]    = (int)(trans.data >> 32);
+    args[argIdx++]    = trans.data_width;
+    args[argIdx++]    = valid;
+    setVhpiParams(cb, VHPI_VGETQUEUETRANS, args, VGETQUEUETRANS_START_OF_OUTPUTS, VGETQUEUETRANS_NUM_ARGS);
+#else
+    *op               = trans.op;
+    *addr             = (int)(trans.addr & 0xffffffffULL);
+    *addrhi           = (int)(trans.addr >> 32);
+    *addrwidth        = trans.addr_width;
+    *data             = (int)(trans.data & 0xffffffffULL);
+    *datahi           = (int)(trans.data >> 32);
+    *datawidth        = trans.data_width;
+    *valid_out        = valid;
+#endif
+}
+
+// -------------------------------------------------------------------------
+// VPutQueueResp()
+//
+// Return the read data and status of the transaction last fetched with
+// VGetQueueTrans() to the node's completion queue, tagged as submitted.
+// A batched transaction has no completion, with any read data written,
+// masked to its width, straight to its record instead. The read data
+// of a read future, if available, is written to its slot.
+//
+// -------------------------------------------------------------------------
+
+VPROC_RTN_TYPE VPutQueueResp(VPUTQUEUERESP_PARAMS)
+{
+#if defined(ALDEC)
+    int args[VPUTQUEUERESP_NUM_ARGS];
+
+    getVhpiParams(cb, VHPI_VPUTQUEUERESP, args, VPUTQUEUERESP_NUM_ARGS);
+
+    int argIdx           = 0;
+    int node             = args[argIdx++];
+    int data             = args[argIdx++];
+    int datahi           = args[argIdx++];
+    int status           = args[argIdx++];
+#endif
+
+    vqueue_t*     q      = &(ns[node]->queue);
+    vqueue_resp_t resp;
+
+    resp.tag             = q->cur_tag;
+    resp.data            = ((uint64_t)(uint32_t)datahi << 32) | (uint64_t)(uint32_t)data;
+    resp.status          = status;
+
+    if (q->cur_future)
+    {
+        vfuture_t* f      = &q->fut;
+        int        slot   = f->completed & (VP_FUTURE_SIZE-1);
+
+        q->cur_future     = false;
+
+        if (status || VFutureWaited(f))
+        {
+            f->data[slot] = (f->width[slot] < 64) ? resp.data & ((1ULL << f->width[slot]) - 1) : resp.data;
+            f->completed++;
+        }
+        else
+        {
+            f->stop       = true;
+        }
+        return;
+    }
+
+    if (q->cur_batch)
+    {
+        if (q->cur_rdata != NULL)
+        {
+            *q->cur_rdata = (q->cur_width < 64) ? resp.data & ((1ULL << q->cur_width) - 1) : resp.data;
+        }
+        return;
+    }
+
+    // Space was checked when the transaction was fetched
+    VQueuePush(&q->cq, resp);
 }
 
 // -------------------------------------------------------------------------
 // VIrqVec()
 ///
 // Main routine called whenever VIrqVec procedure invoked on
-// clock edge of scheduled cycle.
+// clock edge of scheduled cycle. The interrupt vector is pushed, with
+// the node's VTrans call count, to the node's interrupt event queue,
+// for the user side to call the interrupt callback, rather than it
+// being called here on the simulator's thread.
 //
 // -------------------------------------------------------------------------
 
@@ -450,16 +1425,26 @@ VPROC_RTN_TYPE VIrqVec (VIRQVEC_PARAMS)
     int node, irq;
     int args[VIRQVEC_NUM_ARGS];
 
-    getVhpiParams(cb, args, VIRQVEC_NUM_ARGS);
+    getVhpiParams(cb, VHPI_VIRQVEC, args, VIRQVEC_NUM_ARGS);
     
     int argIdx = 0;
     node = args[argIdx++];
     irq  = args[argIdx++];
 #endif
 
-    if (ns[node]->VIntVecCB != NULL)
+    DebugVPrint("VIrqVec(): node %d interrupt vector %d\n", node, irq);
+
+    VIrqQueue(node, (uint32_t)irq);
+
+    // Flag the interrupt to a read poll in progress, in the high word of its
+    // stop on interrupt descriptor word, for CoSimReadPoll to end the poll if
+    // requested. The user thread is blocked until the poll completes, so
+    // does not access the send buffer meanwhile.
+    if (ns[node]->read_poll)
     {
-        (*(ns[node]->VIntVecCB))(irq);
+        uint32_t raised = 1;
+
+        memcpy(&ns[node]->send_buf.databuf[ns[node]->send_buf.buf_sel][VP_POLL_IRQ_IDX + 4], &raised, sizeof(raised));
     }
 }
 
@@ -15,6 +15,8 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   ????.??    Adding transaction queue procedures
+//    10/2026   ????.??    Adding word based burst buffer access procedures
 //    07/2025   ????.??    Adding VIrqVec CoSim procedure
 //    05/2023   2023.05    Refactored VTrans arguments
 //    10/2022   2023.01    Initial revision
@@ -60,6 +62,11 @@
                                    int* VPParam
 #define VGETBURSTWRBYTE_PARAMS     int  node,     int  idx,         int* data
 #define VSETBURSTRDBYTE_PARAMS     int  node,     int  idx,         int  data
+#define VGETBURSTWRWORD_PARAMS     int  node,     int  idx,         int* data,        int* datahi
+#define VSETBURSTRDWORD_PARAMS     int  node,     int  idx,         int  data,        int  datahi
+#define VGETQUEUETRANS_PARAMS      int  node,     int* op,          int* addr,        int* addrhi,      int* addrwidth,   \
+                                   int* data,     int* datahi,      int* datawidth,   int* valid_out
+#define VPUTQUEUERESP_PARAMS       int  node,     int  data,        int  datahi,      int  status
 
 #define VPROC_RTN_TYPE             void
 
@@ -73,15 +80,25 @@
 #define VTRANS_PARAMS                       const struct vhpiCbDataS* cb
 #define VGETBURSTWRBYTE_PARAMS              const struct vhpiCbDataS* cb
 #define VSETBURSTRDBYTE_PARAMS              const struct vhpiCbDataS* cb
+#define VGETBURSTWRWORD_PARAMS              const struct vhpiCbDataS* cb
+#define VSETBURSTRDWORD_PARAMS              const struct vhpiCbDataS* cb
+#define VGETQUEUETRANS_PARAMS               const struct vhpiCbDataS* cb
+#define VPUTQUEUERESP_PARAMS                const struct vhpiCbDataS* cb
 
 #define VINIT_NUM_ARGS                      1
 #define VIRQVEC_NUM_ARGS                    2
 #define VTRANS_NUM_ARGS                     17
 #define VGETBURSTWRBYTE_NUM_ARGS            3
 #define VSETBURSTRDBYTE_NUM_ARGS            3
+#define VGETBURSTWRWORD_NUM_ARGS            4
+#define VSETBURSTRDWORD_NUM_ARGS            4
+#define VGETQUEUETRANS_NUM_ARGS             9
+#define VPUTQUEUERESP_NUM_ARGS              4
                                             
 #define VTRANS_START_OF_OUTPUTS             5
 #define VGETBURSTWRBYTE_START_OF_OUTPUTS    2
+#define VGETBURSTWRWORD_START_OF_OUTPUTS    2
+#define VGETQUEUETRANS_START_OF_OUTPUTS     1
 
 #define VPROC_RTN_TYPE                      PLI_VOID
 
@@ -92,5 +109,9 @@ extern LINKAGE VPROC_RTN_TYPE VIrqVec         (VIRQVEC_PARAMS);
 extern LINKAGE VPROC_RTN_TYPE VTrans          (VTRANS_PARAMS);
 extern LINKAGE VPROC_RTN_TYPE VSetBurstRdByte (VSETBURSTRDBYTE_PARAMS);
 extern LINKAGE VPROC_RTN_TYPE VGetBurstWrByte (VGETBURSTWRBYTE_PARAMS);
+extern LINKAGE VPROC_RTN_TYPE VSetBurstRdWord (VSETBURSTRDWORD_PARAMS);
+extern LINKAGE VPROC_RTN_TYPE VGetBurstWrWord (VGETBURSTWRWORD_PARAMS);
+extern LINKAGE VPROC_RTN_TYPE VGetQueueTrans  (VGETQUEUETRANS_PARAMS);
+extern LINKAGE VPROC_RTN_TYPE VPutQueueResp   (VPUTQUEUERESP_PARAMS);
 
 #endif
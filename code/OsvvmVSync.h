@@ -0,0 +1,326 @@
+// =========================================================================
+//
+//  File Name:         OsvvmVSync.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Handshake synchronisation between the simulator and user threads
+//      of a co-simulation node. Either a POSIX semaphore, or an atomic
+//      sequence number that is spun on for a configurable number of
+//      iterations before falling back to a futex sleep. Alternatively
+//      the user code runs as a coroutine, switched to and from directly
+//      on the simulator's thread, or resumed on one of a fixed pool of
+//      worker threads, concurrently with the other nodes dispatched in
+//      the same delta cycle.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Added worker pool mode
+//    10/2026   ????.??    Added coroutine mode
+//    10/2026   ????.??    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_VSYNC_H_
+#define _OSVVM_VSYNC_H_
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <atomic>
+#include <sched.h>
+#include <semaphore.h>
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
+#if !defined(_WIN32) && !defined(DISABLE_VUSERMAIN_THREAD)
+#include <ucontext.h>
+#include <sys/mman.h>
+#define VP_HAVE_COROUTINE
+#endif
+
+// -------------------------------------------------------------------------
+// DEFINES AND MACROS
+// -------------------------------------------------------------------------
+
+#define VP_CACHE_LINE_SIZE      64
+
+// Number of polls of the sequence number before sleeping, in spin mode
+#ifndef VP_DEFAULT_SPIN_COUNT
+#define VP_DEFAULT_SPIN_COUNT   4000
+#endif
+
+// Size of each node's stack, in coroutine mode. Only touched pages are
+// committed.
+#ifndef VP_DEFAULT_STACK_SIZE
+#define VP_DEFAULT_STACK_SIZE   (8*1024*1024)
+#endif
+
+#define VP_STACK_GUARD_SIZE     4096
+
+// Number of worker threads resuming node coroutines, in pool mode
+#ifndef VP_DEFAULT_POOL_THREADS
+#define VP_DEFAULT_POOL_THREADS 1
+#endif
+
+// Environment variables to override the compiled handshake mode
+// ("SEM", "SPIN", "COROUTINE" or "POOL"), spin count, coroutine stack
+// size and number of pool worker threads
+#define VP_HANDSHAKE_ENV        "OSVVM_COSIM_HANDSHAKE"
+#define VP_SPIN_COUNT_ENV       "OSVVM_COSIM_SPIN_COUNT"
+#define VP_STACK_SIZE_ENV       "OSVVM_COSIM_STACK_SIZE"
+#define VP_POOL_THREADS_ENV     "OSVVM_COSIM_POOL_THREADS"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VP_CPU_RELAX()          __builtin_ia32_pause()
+#elif defined(__aarch64__)
+#define VP_CPU_RELAX()          __asm__ __volatile__("yield")
+#else
+#define VP_CPU_RELAX()
+#endif
+
+// -------------------------------------------------------------------------
+// TYPEDEFS
+// -------------------------------------------------------------------------
+
+typedef enum vp_handshake_e
+{
+    VP_HANDSHAKE_SEM = 0,
+    VP_HANDSHAKE_SPIN,
+    VP_HANDSHAKE_COROUTINE,
+    VP_HANDSHAKE_POOL
+} vp_handshake_t;
+
+// One direction of a node's handshake, posted by one thread and waited
+// on by one other. Aligned so that the two directions of a node do not
+// share a cache line.
+typedef struct alignas(VP_CACHE_LINE_SIZE) vsync_s
+{
+    std::atomic<uint32_t> seq;      // Count of posts
+    std::atomic<uint32_t> waiting;  // Waiter is (about to be) asleep on seq
+    uint32_t              last;     // Count of posts consumed by the waiter
+    sem_t                 sem;
+} vsync_t;
+
+// A node's user code coroutine, and the simulator context that it
+// switches back to
+typedef struct vco_s
+{
+#if defined(VP_HAVE_COROUTINE)
+    ucontext_t            sim_ctx;
+    ucontext_t            user_ctx;
+#endif
+    void*                 stack;
+    size_t                stack_size;
+} vco_t;
+
+// Handshake configuration, common to all nodes and set once by VInit
+extern vp_handshake_t vp_handshake_mode;
+extern int            vp_spin_count;
+extern size_t         vp_stack_size;
+extern int            vp_pool_threads;
+
+// -------------------------------------------------------------------------
+// FUNCTION DEFINITIONS
+// -------------------------------------------------------------------------
+
+// -------------------------------------------------------------------------
+// VSyncIsCoroutine()
+//
+// True if the user code runs as a coroutine, on the simulator's thread
+// or on a pool worker thread
+//
+// -------------------------------------------------------------------------
+
+static inline bool VSyncIsCoroutine (void)
+{
+    return vp_handshake_mode == VP_HANDSHAKE_COROUTINE || vp_handshake_mode == VP_HANDSHAKE_POOL;
+}
+
+// -------------------------------------------------------------------------
+// VSyncInit()
+//
+// Initialise a handshake with no outstanding posts. Returns -1 on error.
+//
+// -------------------------------------------------------------------------
+
+static inline int VSyncInit (vsync_t* s)
+{
+    s->seq.store(0);
+    s->waiting.store(0);
+    s->last = 0;
+
+    return sem_init(&s->sem, 0, 0);
+}
+
+// -------------------------------------------------------------------------
+// VSyncPost()
+//
+// Post to the handshake, waking the waiter if asleep. Returns -1 on error.
+//
+// -------------------------------------------------------------------------
+
+static inline int VSyncPost (vsync_t* s)
+{
+    if (vp_handshake_mode == VP_HANDSHAKE_SEM)
+    {
+        return sem_post(&s->sem);
+    }
+
+    s->seq.fetch_add(1);
+
+    // Only make a system call if the waiter gave up spinning
+    if (s->waiting.load())
+    {
+#if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&s->seq), FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+#endif
+    }
+
+    return 0;
+}
+
+// -------------------------------------------------------------------------
+// VSyncWait()
+//
+// Wait for, and consume, a post to the handshake. In spin mode the
+// sequence number is polled vp_spin_count times before sleeping on it.
+// Returns -1 on error.
+//
+// -------------------------------------------------------------------------
+
+static inline int VSyncWait (vsync_t* s)
+{
+    if (vp_handshake_mode == VP_HANDSHAKE_SEM)
+    {
+        return sem_wait(&s->sem);
+    }
+
+    uint32_t last = s->last;
+
+    for (int idx = 0; idx < vp_spin_count && s->seq.load(std::memory_order_acquire) == last; idx++)
+    {
+        VP_CPU_RELAX();
+    }
+
+    while (s->seq.load() == last)
+    {
+        // Flag sleeping before the final check, so a post either sees
+        // the flag or is seen by the check
+        s->waiting.store(1);
+
+        if (s->seq.load() == last)
+        {
+#if defined(__linux__)
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&s->seq), FUTEX_WAIT_PRIVATE, last, NULL, NULL, 0);
+#else
+            sched_yield();
+#endif
+        }
+
+        s->waiting.store(0);
+    }
+
+    s->last = last + 1;
+
+    return 0;
+}
+
+#if defined(VP_HAVE_COROUTINE)
+
+// -------------------------------------------------------------------------
+// VCoInit()
+//
+// Create a coroutine that will call func(arg) when first resumed, with
+// a stack of stack_size bytes (including a guard page). Returns -1 on
+// error.
+//
+// -------------------------------------------------------------------------
+
+static inline int VCoInit (vco_t* co, void (*func)(const int), const int arg, const size_t stack_size)
+{
+    co->stack_size = stack_size;
+    co->stack      = mmap(NULL, stack_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+    if (co->stack == MAP_FAILED)
+    {
+        co->stack = NULL;
+        return -1;
+    }
+
+    // Fault on stack overflow, rather than corrupting memory
+    mprotect(co->stack, VP_STACK_GUARD_SIZE, PROT_NONE);
+
+    if (getcontext(&co->user_ctx) == -1)
+    {
+        return -1;
+    }
+
+    co->user_ctx.uc_stack.ss_sp   = co->stack;
+    co->user_ctx.uc_stack.ss_size = stack_size;
+    co->user_ctx.uc_link          = &co->sim_ctx;
+
+    makecontext(&co->user_ctx, (void (*)(void))func, 1, arg);
+
+    return 0;
+}
+
+// -------------------------------------------------------------------------
+// VCoResume()
+//
+// Called on the simulator thread, or a pool worker thread, to switch to
+// the coroutine, returning when it next yields. Returns -1 on error.
+//
+// -------------------------------------------------------------------------
+
+static inline int VCoResume (vco_t* co)
+{
+    return swapcontext(&co->sim_ctx, &co->user_ctx);
+}
+
+// -------------------------------------------------------------------------
+// VCoYield()
+//
+// Called from the coroutine to switch back to the thread that resumed
+// it, returning when next resumed by the same thread. Returns -1 on
+// error.
+//
+// -------------------------------------------------------------------------
+
+static inline int VCoYield (vco_t* co)
+{
+    return swapcontext(&co->user_ctx, &co->sim_ctx);
+}
+
+#endif
+
+#endif
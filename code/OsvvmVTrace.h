@@ -0,0 +1,151 @@
+// =========================================================================
+//
+//  File Name:         OsvvmVTrace.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Binary transaction trace recorder. When the OSVVM_COSIM_TRACE
+//      environment variable names a file, every message exchange of
+//      every node is recorded as a fixed size record in a ring buffer
+//      in that file, memory mapped so that no system calls are made
+//      when recording. The ring holds the last OSVVM_COSIM_TRACE_RECS
+//      records (rounded up to a power of 2), and is converted to text or
+//      a socket script with Scripts/cosim_trace.py.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Record node widened for up to VP_MAX_NODES nodes (version 2)
+//    10/2026   ????.??    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_VTRACE_H_
+#define _OSVVM_VTRACE_H_
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <atomic>
+
+// -------------------------------------------------------------------------
+// DEFINES AND MACROS
+// -------------------------------------------------------------------------
+
+#define VP_TRACE_ENV            "OSVVM_COSIM_TRACE"
+#define VP_TRACE_RECS_ENV       "OSVVM_COSIM_TRACE_RECS"
+
+#define VP_TRACE_DEFAULT_RECS   (1 << 20)
+#define VP_TRACE_MAGIC          "VPTRACE"
+#define VP_TRACE_VERSION        2
+
+// -------------------------------------------------------------------------
+// TYPEDEFS
+// -------------------------------------------------------------------------
+
+// File header, followed by the ring of records. head is the free running
+// count of records written, with record n at index n % num_recs.
+typedef struct
+{
+    char                  magic[8];
+    uint32_t              version;
+    uint32_t              rec_size;
+    uint64_t              num_recs;
+    std::atomic<uint64_t> head;
+    uint8_t               reserved[32];
+} vtrace_hdr_t;
+
+// A message exchange between a node's user code and the simulator. The
+// sequence number is that of the record, to detect records overwritten
+// whilst being written.
+typedef struct
+{
+    uint64_t              seq;
+    uint64_t              addr;
+    uint64_t              wdata;
+    uint64_t              rdata;
+    uint32_t              burst_bytes;
+    uint32_t              ticks;
+    uint32_t              interrupt;
+    uint32_t              op;
+    uint32_t              type;
+    uint32_t              node;
+} vtrace_rec_t;
+
+// Process wide trace state, with recs NULL when tracing is disabled
+typedef struct
+{
+    vtrace_hdr_t*         hdr;
+    vtrace_rec_t*         recs;
+    uint64_t              mask;
+} vtrace_t;
+
+// -------------------------------------------------------------------------
+// EXTERNAL DECLARATIONS
+// -------------------------------------------------------------------------
+
+extern vtrace_t vp_trace;
+
+extern void VTraceInit (void);
+
+// -------------------------------------------------------------------------
+// FUNCTION DEFINITIONS
+// -------------------------------------------------------------------------
+
+// -------------------------------------------------------------------------
+// VTraceRecord()
+//
+// Record a message exchange, if tracing is enabled. Safe to call
+// from the user threads of multiple nodes.
+//
+// -------------------------------------------------------------------------
+
+static inline void VTraceRecord (const uint32_t node, const int op, const int type, const uint64_t addr,
+                                 const uint64_t wdata, const uint64_t rdata, const int burst_bytes,
+                                 const int ticks, const unsigned int interrupt)
+{
+    if (vp_trace.recs == NULL)
+    {
+        return;
+    }
+
+    uint64_t      seq = vp_trace.hdr->head.fetch_add(1, std::memory_order_relaxed);
+    vtrace_rec_t* rec = &vp_trace.recs[seq & vp_trace.mask];
+
+    rec->seq          = seq;
+    rec->addr         = addr;
+    rec->wdata        = wdata;
+    rec->rdata        = rdata;
+    rec->burst_bytes  = burst_bytes;
+    rec->ticks        = ticks;
+    rec->interrupt    = interrupt;
+    rec->op           = op;
+    rec->type         = type;
+    rec->node         = node;
+}
+
+#endif
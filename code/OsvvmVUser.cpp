@@ -17,6 +17,29 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   ????.??    Added VIrqWait and VIrqWakeWaiters, for ISR threads to sleep
+//    10/2026   ????.??    Static node access mutexes kept for GHDL
+//    10/2026   ????.??    Stale read future ids rejected, and ready() fetches read data
+//    10/2026   ????.??    VIrqVec and interrupt vector change events drained in order
+//                         on the user side
+//    10/2026   ????.??    Scatter-gather bursts, gathered into and scattered from
+//                         the burst buffers
+//    10/2026   ????.??    User side read cache for cacheable address ranges, updated
+//                         by queued and batched writes
+//    10/2026   ????.??    Batched transactions and read futures through the
+//                         submission queue, and HDL side read polling
+//    10/2026   ????.??    User thread node set for log tags
+//    10/2026   ????.??    Event driven VWaitForSim, and cached VUserMain symbols
+//    10/2026   ????.??    User code coroutines resumed on a worker pool
+//    10/2026   ????.??    Access mutex in node state, for any number of nodes
+//    10/2026   ????.??    Message exchanges recorded by transaction trace recorder
+//    10/2026   ????.??    Optional performance counters
+//    10/2026   ????.??    Transaction submission and completion queues
+//    10/2026   ????.??    Optional coroutine execution of user code
+//    10/2026   ????.??    Bursts of any size, chunked through double banked buffers
+//    10/2026   ????.??    Multi-tick VTick counted down by the simulator
+//    10/2026   ????.??    Messages built in place in node state, without buffer copies
+//    10/2026   ????.??    Node handshake through selectable VSync functions
 //    09/2025   ????.??    Added support for Set- & Get- burst mode and model options
 //    05/2023   2023.05    Adding support for Async, Check and Try functionality
 //    04/2023   2023.04    Adding basic stream support
@@ -48,7 +71,13 @@
 #include <stdint.h>
 #include <errno.h>
 #include <unistd.h>
+#include <string.h>
+#include <algorithm>
 #include <mutex>
+#include <vector>
+#if defined(VP_NUMA)
+#include <numa.h>
+#endif
 
 #include "OsvvmVProc.h"
 #include "OsvvmVUser.h"
@@ -83,12 +112,27 @@ static symhdl_t hdlvp;
 #endif
 
 #if defined(GHDL)
-// GHDL, when callable, locks up using mutex pointers/new, so make an array of mutexes for GHDL
+// GHDL, when callable, locks up using mutex pointers/new, so make an array of mutexes for GHDL,
+// rather than using those in the node state. Zero initialised, so only touched pages are committed.
 static std::mutex  acc_mx[VP_MAX_NODES];
-#else
-static std::mutex *acc_mx[VP_MAX_NODES];
 #endif
 
+// VUserMain<node> entry points, resolved for all nodes initialised when first
+// needed, and shared object handle access, serialised by vp_sym_mx
+static std::mutex                vp_sym_mx;
+static std::vector<pVUserMain_t> vp_user_mains;
+
+// Header fields of a burst message, common to each of its chunks
+typedef struct
+{
+    int                 op;
+    trans_type_e        type;
+    uint64_t            addr;
+    int                 prot;
+    int                 param;
+    bool                burst_type_in_data;  // Burst sub-operation in data field (with user param in param)
+} burst_hdr_t;
+
 // -------------------------------------------------------------------------
 // FUNCTION DEFINITIONS
 // -------------------------------------------------------------------------
@@ -106,7 +150,9 @@ static void VInitSendBuf(send_buf_t &sbuf)
     sbuf.addr            = 0;
     sbuf.prot            = 0;
     sbuf.num_burst_bytes = 0;
+    sbuf.buf_sel         = 0;
     sbuf.ticks           = 0;
+    sbuf.tick_count      = 0;
     sbuf.done            = 0;
     sbuf.error           = 0;
     sbuf.param           = 0;
@@ -123,13 +169,75 @@ static void VWaitOnFirstMessage(const uint32_t node)
 {
     int status;
 
+    // A coroutine is first resumed by the first message
+    if (VSyncIsCoroutine())
+    {
+        return;
+    }
+
     // Wait for first message from simulator
     DebugVPrint("VWaitForSim(): waiting for first message semaphore rcv[%d]\n", node);
-    if ((status = sem_wait(&(ns[node]->rcv))) == -1)
+    if ((status = VSyncWait(&(ns[node]->rcv))) == -1)
     {
         printf("***Error: bad sem_post status (%d) on node %d (VUserInit)\n", status, node);
         exit(1);
     }
+
+    VPERF_USER_WAKE(ns[node]->perf);
+}
+
+// -------------------------------------------------------------------------
+// VUserMainLookup()
+//
+// Get a node's VUserMain<node> entry point. The symbols of all the nodes
+// initialised so far are resolved in a single pass over the user shared
+// object, with later passes only for nodes initialised afterwards.
+//
+// -------------------------------------------------------------------------
+
+static pVUserMain_t VUserMainLookup (const int node)
+{
+    std::lock_guard<std::mutex> lock(vp_sym_mx);
+
+    if ((size_t)node >= vp_user_mains.size())
+    {
+        char     funcname[DEFAULT_STR_BUF_SIZE];
+        size_t   num_nodes = std::max((size_t)ns.size(), (size_t)node + 1);
+        symhdl_t hdlvu;
+
+#if defined(ACTIVEHDL)
+        // No separate user DLL under Active-HDL so simply use the VProc.so handle
+        hdlvu = hdlvp;
+#else
+        // Load user shared object to get handle to lookup VUsermain function symbols
+        hdlvu = dlopen("./VUser.so", RTLD_LAZY | RTLD_GLOBAL);
+
+        if (hdlvu == NULL)
+        {
+            VPrint("***Error: failed to load VUser.so. %s\n", dlerror());
+            return NULL;
+        }
+#endif
+
+        for (size_t idx = vp_user_mains.size(); idx < num_nodes; idx++)
+        {
+            sprintf(funcname, "%s%d", "VUserMain", (int)idx);
+            vp_user_mains.push_back((pVUserMain_t) dlsym(hdlvu, funcname));
+        }
+
+#if defined(ACTIVEHDL) || defined(SIEMENS) || (defined(ALDEC) && !defined(_WIN32))
+        // Close the VProc.so handle to decrement the count, incremented with the open
+        if (hdlvp != NULL)
+        {
+            dlclose(hdlvp);
+            hdlvp = NULL;
+        }
+#endif
+
+        DebugVPrint("VUserMainLookup(): resolved user entry points for %d nodes\n", (int)num_nodes);
+    }
+
+    return vp_user_mains[node];
 }
 
 // -------------------------------------------------------------------------
@@ -143,50 +251,30 @@ static void VWaitOnFirstMessage(const uint32_t node)
 static void VUserInit (const int node)
 {
     pVUserMain_t VUserMain_func;
-    char funcname[DEFAULT_STR_BUF_SIZE];
-    char vusersoname[DEFAULT_STR_BUF_SIZE];
-    int status;
-    symhdl_t hdlvu;
 
     DebugVPrint("VUserInit(%d)\n", node);
 
-    VWaitOnFirstMessage(node);
-
-    // Get function name of user entry routine
-    sprintf(funcname, "%s%d",    "VUserMain", node);
+    // Tag the messages of a user thread with its node (set on resume for coroutines)
+    VLogSetNode(node);
 
-#if !defined(GHDL)
-    // Create a new mutex for this node
-    acc_mx[node] = new std::mutex;
-#endif
-
-#if defined(ACTIVEHDL)
-    // No separate user DLL under Active-HDL so simply use the VProc.so handle
-    hdlvu = hdlvp;
-#else
-    sprintf(vusersoname, "./VUser.so");
-    // Load user shared object to get handle to lookup VUsermain function symbols
-    hdlvu = dlopen(vusersoname, RTLD_LAZY | RTLD_GLOBAL);
-
-    if (hdlvu == NULL)
+#if defined(VP_NUMA)
+    // Run the user thread on the NUMA node of its node state
+    if (!VSyncIsCoroutine() && ns[node]->numa_node >= 0)
     {
-        VPrint("***Error: failed to load VUser.so. %s\n", dlerror());
+        numa_run_on_node(ns[node]->numa_node);
     }
 #endif
 
+    VWaitOnFirstMessage(node);
+
     // Get the function pointer for the entry routine
-    if ((VUserMain_func = (pVUserMain_t) dlsym(hdlvu, funcname)) == NULL)
+    if ((VUserMain_func = VUserMainLookup(node)) == NULL)
     {
-        printf("***Error: failed to find user code symbol %s (VUserInit)\n", funcname);
+        printf("***Error: failed to find user code symbol %s%d (VUserInit)\n", "VUserMain", node);
         exit(1);
     }
 
-#if defined(ACTIVEHDL) || defined(SIEMENS) || (defined(ALDEC) && !defined(_WIN32))
-    // Close the VProc.so handle to decrement the count, incremented with the open
-    dlclose(hdlvp);
-#endif
-
-    DebugVPrint("VUserInit(): got user function (%s) for node %d (%p)\n", funcname, node, VUserMain_func);
+    DebugVPrint("VUserInit(): got user function for node %d (%p)\n", node, VUserMain_func);
 
     DebugVPrint("VUserInit(): calling user code for node %d\n", node);
 
@@ -194,6 +282,16 @@ static void VUserInit (const int node)
     DebugVPrint("VUserInit(): calling VUserMain%d\n", node);
     VUserMain_func(node);
 
+    // A coroutine must not return, and spinning would hang the simulator's (or a pool worker's)
+    // thread, so sleep the node instead
+    if (VSyncIsCoroutine())
+    {
+        while(true)
+        {
+            VTick(GO_TO_SLEEP, false, false, node);
+        }
+    }
+
     while(true);
 }
 
@@ -220,16 +318,36 @@ int VUser (const int node)
     DebugVPrint("VUser(): initialised interrupt table node %d\n", node);
 
 #if defined(ACTIVEHDL) || defined (SIEMENS) || (defined(ALDEC) && !defined(_WIN32))
-    // Load VProc shared object to make symbols global
-    hdlvp = dlopen("./VProc.so", RTLD_LAZY | RTLD_GLOBAL);
-
-    if (hdlvp == NULL)
     {
-        VPrint("***Error: failed to load VProc.so. %s\n", dlerror());
+        std::lock_guard<std::mutex> lock(vp_sym_mx);
+
+        // Load VProc shared object to make symbols global, once for all
+        // the nodes initialised before the user symbols are next resolved
+        if (hdlvp == NULL && (hdlvp = dlopen("./VProc.so", RTLD_LAZY | RTLD_GLOBAL)) == NULL)
+        {
+            VPrint("***Error: failed to load VProc.so. %s\n", dlerror());
+        }
     }
 #endif
 
 
+#if defined(VP_HAVE_COROUTINE)
+    // Create the user code coroutine, to be first resumed by VTrans on the simulator's thread,
+    // or on a pool worker thread
+    if (VSyncIsCoroutine())
+    {
+        if (VCoInit(&(ns[node]->co), VUserInit, node, vp_stack_size) == -1)
+        {
+            VPrint("***Error: VUser() failed to create coroutine for node %d\n", node);
+            return 1;
+        }
+
+        DebugVPrint("VUser(): created user coroutine for node %d\n", node);
+
+        return 0;
+    }
+#endif
+
 #ifndef DISABLE_VUSERMAIN_THREAD
     // Set off the user code thread
     if (status = pthread_create(&thread, NULL, (pThreadFunc_t)VUserInit, (void *)((long long)node)))
@@ -244,71 +362,211 @@ int VUser (const int node)
 }
 
 // -------------------------------------------------------------------------
-// VExch()
+// VExchGuard
 //
-// Message exchange routine. Handles all messages to and from
-// simulation process (apart from initialisation). Each sent
-// message has a reply. Interrupt messages require that
-// the original IO message reply is waited for again.
+// Scoped lock of a node's access mutex, as code is critical if accessed
+// from multiple threads for the same node. Held from building a message
+// in the node's send buffer until its reply has been read from the node's
+// receive buffer.
 //
 // -------------------------------------------------------------------------
 
-static void VExch (psend_buf_t psbuf, prcv_buf_t prbuf, const uint32_t node)
+class VExchGuard
 {
-    // Lock mutex as code is critical if accessed from multiple threads
-    // for the same node.
-#if defined (GHDL)
-    acc_mx[node].lock();
+public:
+    VExchGuard (const uint32_t node) : node(node)
+    {
+#if defined(GHDL)
+        acc_mx[node].lock();
 #else
-    acc_mx[node]->lock();
+        ns[node]->acc_mx.lock();
 #endif
+    }
+
+    // Other than for GHDL, the mutex is renewed with the node state on
+    // each VInit, so is never carried over to subsequent GUI runs
+    ~VExchGuard ()
+    {
+#if defined(GHDL)
+        acc_mx[node].unlock();
+#else
+        ns[node]->acc_mx.unlock();
+#endif
+    }
+
+private:
+    const uint32_t node;
+};
 
+// -------------------------------------------------------------------------
+// VExchSendBuf()
+//
+// Returns the node's send buffer, initialised for a new message, for
+// the message to be built in place. Must be called with the node's
+// VExchGuard held.
+//
+// -------------------------------------------------------------------------
+
+static inline psend_buf_t VExchSendBuf (const uint32_t node)
+{
+    psend_buf_t psbuf = &ns[node]->send_buf;
+
+    VInitSendBuf(*psbuf);
+
+    return psbuf;
+}
+
+// -------------------------------------------------------------------------
+// VExchPost()
+//
+// Send the message built in place in the node's send buffer to the
+// simulation process, without waiting for the reply. Must be followed
+// by a VExchWait() before the send buffer's message fields are
+// modified. In coroutine mode the simulation has processed the message,
+// and replied, on return.
+//
+// -------------------------------------------------------------------------
+
+static inline void VExchPost (const uint32_t node)
+{
     int status;
 
+    VPERF_USER_POST(ns[node]->perf);
+
+#if defined(VP_HAVE_COROUTINE)
+    // Switch straight back to the simulator, which returns here with the reply
+    if (VSyncIsCoroutine())
+    {
+        DebugVPrint("VExchPost(): yielding node %d coroutine\n", node);
+
+        if ((status = VCoYield(&(ns[node]->co))) == -1)
+        {
+            printf("***Error: bad swapcontext status (%d) on node %d (VExchPost)\n", status, node);
+            exit(1);
+        }
+
+        return;
+    }
+#endif
+
     // Send message to simulator
-    ns[node]->send_buf = *psbuf;
-    DebugVPrint("VExch(): setting snd[%d] semaphore\n", node);
+    DebugVPrint("VExchPost(): setting snd[%d] semaphore\n", node);
 
-    if ((status = sem_post(&(ns[node]->snd))) == -1)
+    if ((status = VSyncPost(&(ns[node]->snd))) == -1)
     {
-        printf("***Error: bad sem_post status (%d) on node %d (VExch)\n", status, node);
+        printf("***Error: bad sem_post status (%d) on node %d (VExchPost)\n", status, node);
         exit(1);
     }
+}
+
+// -------------------------------------------------------------------------
+// VIrqDrainEvents()
+//
+// Drain the node's interrupt event queue, calling the registered
+// interrupt callback for each event in the order raised by VIrqVec.
+// Each event is popped under the queue's mutex, but the callback is
+// called with it released, so that a callback on an ISR thread may
+// itself make transactions. Returns the number of events drained.
+//
+// -------------------------------------------------------------------------
+
+static int VIrqDrainEvents (const uint32_t node)
+{
+    virq_queue_t* q = &ns[node]->irq;
+    virq_event_t  event;
+    int           count = 0;
 
-    // If this is the last message from the user code
-    // unlock/destroy the mutex, as GUI runs seem to
-    // hold on to the mutex state which hangs a simulation
-    // on subsequent runs.
-#if !defined(GHDL)
-    if (ns[node]->send_buf.done)
+    while (true)
     {
-        delete acc_mx[node];
+        {
+            std::lock_guard<std::mutex> lock(q->mx);
+
+            if (!VQueuePop(&q->ring, &event))
+            {
+                break;
+            }
+
+            q->cur_time = event.timestamp;
+        }
+
+        DebugVPrint("VIrqDrain(): node %d interrupt vector %u at VTrans call %llu\n",
+                    node, event.vec, (unsigned long long)event.timestamp);
+
+        if (ns[node]->VIntVecCB != NULL)
+        {
+            (*(ns[node]->VIntVecCB))((int)event.vec);
+        }
+
+        count++;
+    }
+
+    return count;
+}
+
+// -------------------------------------------------------------------------
+// VExchWait()
+//
+// Wait for the reply to a message sent with VExchPost(), returned in
+// the node's receive buffer. Interrupt messages require that
+// the original IO message reply is waited for again. The exchange is
+// recorded if transaction tracing is enabled.
+//
+// -------------------------------------------------------------------------
+
+static prcv_buf_t VExchWait (const uint32_t node)
+{
+    psend_buf_t psbuf = &ns[node]->send_buf;
+    prcv_buf_t  prbuf = &ns[node]->rcv_buf;
+
+    // Wait for response message from simulator, already received if a coroutine
+    if (!VSyncIsCoroutine())
+    {
+        DebugVPrint("VExchWait(): waiting for rcv[%d] semaphore\n", node);
+        VSyncWait(&(ns[node]->rcv));
     }
-#endif
 
-    // Wait for response message from simulator
-    DebugVPrint("VExch(): waiting for rcv[%d] semaphore\n", node);
-    sem_wait(&(ns[node]->rcv));
+    VPERF_USER_WAKE(ns[node]->perf);
 
-    // Get the pointer to the receive response buffer
-    *prbuf = ns[node]->rcv_buf;
+    if (vp_trace.recs != NULL)
+    {
+        uint64_t wdata;
+
+        memcpy(&wdata, psbuf->data, sizeof(wdata));
+
+        VTraceRecord(node, psbuf->op, psbuf->type, psbuf->addr, wdata,
+                     ((uint64_t)prbuf->data_in_hi << 32) | prbuf->data_in,
+                     psbuf->num_burst_bytes, psbuf->ticks + psbuf->tick_count, prbuf->interrupt);
+    }
 
-    // Call user registered interrupt vector callback if the interrupt vector changes
-    if ((prbuf->interrupt != ns[node]->last_int) && ns[node]->VIntVecCB != NULL)
+    // Call user registered interrupt vector callback for any interrupt
+    // events, raised by VIrqVec or interrupt vector changes, since the
+    // last exchange, unless drained by a dedicated ISR thread
+    if (VIrqPending(&(ns[node]->irq)))
     {
-        psbuf->ticks = (*(ns[node]->VIntVecCB))(prbuf->interrupt);
+        VIrqDrainEvents(node);
     }
 
-    ns[node]->last_int = prbuf->interrupt;
+    DebugVPrint("VExchWait(): returning to user code from node %d\n", node);
 
-    // Unlock mutex
-#if defined(GHDL)
-    acc_mx[node].unlock();
-#else
-    acc_mx[node]->unlock();
-#endif
+    return prbuf;
+}
 
-    DebugVPrint("VExch(): returning to user code from node %d\n", node);
+// -------------------------------------------------------------------------
+// VExch()
+//
+// Message exchange routine. Handles all messages to and from
+// simulation process (apart from initialisation). Each sent
+// message, built in place in the node's send buffer, has a reply,
+// returned in the node's receive buffer. The receive buffer is
+// valid until the node's VExchGuard is released.
+//
+// -------------------------------------------------------------------------
+
+static inline prcv_buf_t VExch (const uint32_t node)
+{
+    VExchPost(node);
+
+    return VExchWait(node);
 }
 
 // -------------------------------------------------------------------------
@@ -322,33 +580,108 @@ void VWaitForSim(const uint32_t node)
 {
 #ifdef DISABLE_VUSERMAIN_THREAD
 
-    int count = 0;
-
-    // Wait until the node's state is initialised (with a time out)
-    while(ns[node] == NULL && count < FIVESEC_TIMEOUT)
+    // Wait until the node's state is initialised, notified by VInit (with a time out)
+    if (ns.wait(node, VP_INIT_TIMEOUT_SECS) == NULL)
     {
-        usleep(HUNDRED_MILLISECS);
-        count++;
+        VPrint("***ERROR: timed out waiting for simulation\n");
+        exit(1);
     }
 
-    usleep(HUNDRED_MILLISECS);
+    // Wait for the first message from the simulator
+    VWaitOnFirstMessage(node);
+#else
+    // When running VUserMain in a thread is not disabled then do nothing
+    return;
+#endif
+
+}
+
+// -------------------------------------------------------------------------
+// VCacheFill()
+//
+// Fill the cache line for addr with a single burst read. Must be called
+// with the node's VExchGuard held.
+//
+// -------------------------------------------------------------------------
+
+static vcache_line_t* VCacheFill (const uint64_t addr, const bool addr64, const int prot, const uint32_t node)
+{
+    vcache_line_t* line  = VCacheLine(&ns[node]->cache, addr);
+    psend_buf_t    psbuf = VExchSendBuf(node);
+
+    psbuf->type            = addr64 ? trans64_burst : trans32_burst;
+    psbuf->addr            = addr & ~(uint64_t)(VP_CACHE_LINE_SIZE - 1);
+    psbuf->prot            = prot;
+    psbuf->op              = READ_BURST;
+    psbuf->num_burst_bytes = VP_CACHE_LINE_SIZE;
+    psbuf->param           = BURST_NORM;
+
+    prcv_buf_t  prbuf = VExch(node);
+
+    line->valid = true;
+    line->tag   = psbuf->addr;
+    memcpy(line->data, prbuf->databuf[0], VP_CACHE_LINE_SIZE);
+
+    return line;
+}
+
+// -------------------------------------------------------------------------
+// VCacheRead()
+//
+// Serve a read of bytes at addr from the node's cache, if in a cacheable
+// range, filling its line on a miss. Returns false if not cacheable. Must
+// be called with the node's VExchGuard held.
+//
+// -------------------------------------------------------------------------
+
+static inline bool VCacheRead (const int op, const uint64_t addr, const bool addr64, const int bytes, const int prot,
+                               uint64_t* data, int* status, const uint32_t node)
+{
+    vcache_t* c = &ns[node]->cache;
 
-    // If timed out, generate an error
-    if (count == FIVESEC_TIMEOUT)
+    if (op != READ_OP || c->num_ranges == 0 || !VCacheable(c, addr, bytes))
     {
-        VPrint("***ERROR: timed out waiting for simulation\n");
-        exit(1);
+        return false;
+    }
+
+    if (VCacheLookup(c, addr, bytes, data))
+    {
+        c->hits++;
     }
     else
     {
-        // Wait for the first message from the simulator
-        VWaitOnFirstMessage(node);
+        vcache_line_t* line = VCacheFill(addr, addr64, prot, node);
+
+        *data = 0;
+        memcpy(data, &line->data[addr - line->tag], bytes);
+
+        c->misses++;
     }
-#else
-    // When running VUserMain in a thread is not disabled then do nothing
-    return;
-#endif
 
+    *status = 0;
+
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// VCacheWriteThrough()
+//
+// Update any cached line with the data of a write transaction. A write
+// address phase, whose data is not known, invalidates the lines it
+// overlaps.
+//
+// -------------------------------------------------------------------------
+
+static inline void VCacheWriteThrough (const int op, const uint64_t addr, const int bytes, const uint64_t data, const uint32_t node)
+{
+    if (op == WRITE_OP || op == ASYNC_WRITE || op == WRITE_AND_READ || op == ASYNC_WRITE_AND_READ)
+    {
+        VCacheWrite(&ns[node]->cache, addr, bytes, data);
+    }
+    else if ((op == WRITE_ADDRESS || op == ASYNC_WRITE_ADDRESS) && ns[node]->cache.num_ranges != 0)
+    {
+        VCacheInvalidateLines(&ns[node]->cache, addr, bytes);
+    }
 }
 
 // -------------------------------------------------------------------------
@@ -360,24 +693,31 @@ void VWaitForSim(const uint32_t node)
 
 uint8_t VTransUserCommon (const int op, uint32_t *addr, const uint8_t data, int* status, const int prot, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
+    VExchGuard  guard(node);
+    uint64_t    cdata;
 
-    VInitSendBuf(sbuf);
+    if (VCacheRead(op, *addr, false, sizeof(data), prot, &cdata, status, node))
+    {
+        return (uint8_t)cdata;
+    }
+
+    psend_buf_t psbuf = VExchSendBuf(node);
+
+    psbuf->type            = trans32_byte;
+    psbuf->addr            = *addr;
+    psbuf->prot            = prot;
+    psbuf->op              = (addr_bus_trans_op_t)op;
 
-    sbuf.type            = trans32_byte;
-    sbuf.addr            = *addr;
-    sbuf.prot            = prot;
-    sbuf.op              = (addr_bus_trans_op_t)op;
+    *((uint8_t*)psbuf->data) = data & 0xffU;
 
-    *((uint8_t*)sbuf.data) = data & 0xffU;
+    prcv_buf_t  prbuf = VExch(node);
 
-    VExch(&sbuf, &rbuf, node);
+    VCacheWriteThrough(op, *addr, sizeof(data), data, node);
 
-    *status = rbuf.status;
-    *addr   = rbuf.addr_in;
+    *status = prbuf->status;
+    *addr   = prbuf->addr_in;
 
-    return rbuf.data_in & 0xffU;
+    return prbuf->data_in & 0xffU;
 }
 
 // -------------------------------------------------------------------------
@@ -389,304 +729,1110 @@ uint8_t VTransUserCommon (const int op, uint32_t *addr, const uint8_t data, int*
 
 uint16_t VTransUserCommon (const int op, uint32_t *addr, const uint16_t data,  int* status, int const prot, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
+    VExchGuard  guard(node);
+    uint64_t    cdata;
+
+    if (VCacheRead(op, *addr, false, sizeof(data), prot, &cdata, status, node))
+    {
+        return (uint16_t)cdata;
+    }
+
+    psend_buf_t psbuf = VExchSendBuf(node);
+
+    psbuf->type            = trans32_hword;
+    psbuf->addr            = *addr;
+    psbuf->prot            = prot;
+    psbuf->op              = (addr_bus_trans_op_t)op;
+
+    *((uint16_t*)psbuf->data) = data & 0xffffU;
+
+    prcv_buf_t  prbuf = VExch(node);
+
+    VCacheWriteThrough(op, *addr, sizeof(data), data, node);
+
+    *status = prbuf->status;
+    *addr   = prbuf->addr_in;
+
+    return prbuf->data_in & 0xffffU;
+}
+
+// -------------------------------------------------------------------------
+// VTransUserCommon()
+//
+// Common 32-bit word transaction exchange function (32-bit address)
+//
+// -------------------------------------------------------------------------
+
+uint32_t VTransUserCommon (const int op, uint32_t *addr, const uint32_t data, int* status,  const int prot, const uint32_t node)
+{
+    VExchGuard  guard(node);
+    uint64_t    cdata;
+
+    if (VCacheRead(op, *addr, false, sizeof(data), prot, &cdata, status, node))
+    {
+        return (uint32_t)cdata;
+    }
+
+    psend_buf_t psbuf = VExchSendBuf(node);
+
+    psbuf->type            = trans32_word;
+    psbuf->addr            = *addr;
+    psbuf->prot            = prot;
+    psbuf->op              = (addr_bus_trans_op_t)op;
+
+    *((uint32_t*)psbuf->data) = data;
+
+    prcv_buf_t  prbuf = VExch(node);
+
+    VCacheWriteThrough(op, *addr, sizeof(data), data, node);
+
+    *status = prbuf->status;
+    *addr   = prbuf->addr_in;
+
+    return prbuf->data_in;
+}
+
+// -------------------------------------------------------------------------
+// VTransUserCommon()
+//
+// Common 8-bit word transaction exchange function (64-bit address)
+//
+// -------------------------------------------------------------------------
+
+uint8_t VTransUserCommon (const int op, uint64_t *addr, const uint8_t data, int* status, const int prot, const uint32_t node)
+{
+    VExchGuard  guard(node);
+    uint64_t    cdata;
 
-    VInitSendBuf(sbuf);
+    if (VCacheRead(op, *addr, true, sizeof(data), prot, &cdata, status, node))
+    {
+        return (uint8_t)cdata;
+    }
 
-    sbuf.type            = trans32_hword;
-    sbuf.addr            = *addr;
-    sbuf.prot            = prot;
-    sbuf.op              = (addr_bus_trans_op_t)op;
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    *((uint16_t*)sbuf.data) = data & 0xffffU;
+    psbuf->type            = trans64_byte;
+    psbuf->addr            = *addr;
+    psbuf->prot            = prot;
+    psbuf->op              = (addr_bus_trans_op_t)op;
+
+    *((uint8_t*)psbuf->data) = data & 0xffU;
+
+    prcv_buf_t  prbuf = VExch(node);
+
+    VCacheWriteThrough(op, *addr, sizeof(data), data, node);
+
+    *status = prbuf->status;
+    *addr   = ((uint64_t)prbuf->addr_in_hi << 32) | ((uint64_t)prbuf->addr_in);
+
+    return prbuf->data_in & 0xffU;
+}
+
+// -------------------------------------------------------------------------
+// VTransUserCommon()
+//
+// Common 16-bit word transaction exchange function (64-bit address)
+//
+// -------------------------------------------------------------------------
+
+uint16_t VTransUserCommon (const int op, uint64_t *addr, const uint16_t data, int* status, const int prot, const uint32_t node)
+{
+    VExchGuard  guard(node);
+    uint64_t    cdata;
+
+    if (VCacheRead(op, *addr, true, sizeof(data), prot, &cdata, status, node))
+    {
+        return (uint16_t)cdata;
+    }
+
+    psend_buf_t psbuf = VExchSendBuf(node);
+
+    psbuf->type            = trans64_hword;
+    psbuf->addr            = *addr;
+    psbuf->prot            = prot;
+    psbuf->op              = (addr_bus_trans_op_t)op;
+
+    *((uint16_t*)psbuf->data) = data & 0xffffU;
+
+    prcv_buf_t  prbuf = VExch(node);
+
+    VCacheWriteThrough(op, *addr, sizeof(data), data, node);
+
+    *status = prbuf->status;
+    *addr   = ((uint64_t)prbuf->addr_in_hi << 32) | ((uint64_t)prbuf->addr_in);
+
+    return prbuf->data_in & 0xffffU;
+}
+
+// -------------------------------------------------------------------------
+// VTransUserCommon()
+//
+// Common 32-bit word transaction exchange function (64-bit address)
+//
+// -------------------------------------------------------------------------
+
+uint32_t VTransUserCommon (const int op, uint64_t *addr, const uint32_t data, int* status, const int prot, const uint32_t node)
+{
+    VExchGuard  guard(node);
+    uint64_t    cdata;
+
+    if (VCacheRead(op, *addr, true, sizeof(data), prot, &cdata, status, node))
+    {
+        return (uint32_t)cdata;
+    }
+
+    psend_buf_t psbuf = VExchSendBuf(node);
+
+    psbuf->type            = trans64_word;
+    psbuf->addr            = *addr;
+    psbuf->prot            = prot;
+    psbuf->op              = (addr_bus_trans_op_t)op;
+
+    *((uint32_t*)psbuf->data) = data;
+
+    prcv_buf_t  prbuf = VExch(node);
+
+    VCacheWriteThrough(op, *addr, sizeof(data), data, node);
+
+    *status = prbuf->status;
+    *addr   = ((uint64_t)prbuf->addr_in_hi << 32) | ((uint64_t)prbuf->addr_in);
+
+    return prbuf->data_in;
+}
+
+// -------------------------------------------------------------------------
+// VTransUserCommon()
+//
+// Common 64-bit word transaction exchange function (64-bit address)
+//
+// -------------------------------------------------------------------------
+
+uint64_t VTransUserCommon (const int op, uint64_t *addr, const uint64_t data, int* status, const int prot, const uint32_t node)
+{
+    VExchGuard  guard(node);
+    uint64_t    cdata;
+
+    if (VCacheRead(op, *addr, true, sizeof(data), prot, &cdata, status, node))
+    {
+        return (uint64_t)cdata;
+    }
+
+    psend_buf_t psbuf = VExchSendBuf(node);
+
+    psbuf->type            = trans64_dword;
+    psbuf->addr            = *addr;
+    psbuf->prot            = prot;
+    psbuf->op              = (addr_bus_trans_op_t)op;
+
+    *((uint64_t*)psbuf->data) = data;
+
+    prcv_buf_t  prbuf = VExch(node);
+
+    VCacheWriteThrough(op, *addr, sizeof(data), data, node);
+
+    *status = prbuf->status;
+    *addr   = ((uint64_t)prbuf->addr_in_hi << 32) | ((uint64_t)prbuf->addr_in);
+
+    return (uint64_t)prbuf->data_in | ((uint64_t)prbuf->data_in_hi << 32);
+}
+
+// -------------------------------------------------------------------------
+// VBurstGather()
+//
+// Copy len bytes, from offset bytes into the burst data segments, to dst
+//
+// -------------------------------------------------------------------------
+
+static void VBurstGather (uint8_t* dst, const vburst_iov_t* iov, const int iovcnt, int offset, int len)
+{
+    for (int idx = 0; idx < iovcnt && len > 0; idx++)
+    {
+        if (offset >= iov[idx].len)
+        {
+            offset -= iov[idx].len;
+            continue;
+        }
+
+        int seglen = std::min(iov[idx].len - offset, len);
+
+        memcpy(dst, iov[idx].base + offset, seglen);
+
+        dst    += seglen;
+        len    -= seglen;
+        offset  = 0;
+    }
+}
+
+// -------------------------------------------------------------------------
+// VBurstScatter()
+//
+// Copy len bytes from src to the burst data segments, from offset bytes
+// into them
+//
+// -------------------------------------------------------------------------
+
+static void VBurstScatter (const uint8_t* src, const vburst_iov_t* iov, const int iovcnt, int offset, int len)
+{
+    for (int idx = 0; idx < iovcnt && len > 0; idx++)
+    {
+        if (offset >= iov[idx].len)
+        {
+            offset -= iov[idx].len;
+            continue;
+        }
+
+        int seglen = std::min(iov[idx].len - offset, len);
+
+        memcpy(iov[idx].base + offset, src, seglen);
+
+        src    += seglen;
+        len    -= seglen;
+        offset  = 0;
+    }
+}
+
+// -------------------------------------------------------------------------
+// VBurstIovBytes()
+//
+// Total number of bytes in the burst data segments
+//
+// -------------------------------------------------------------------------
+
+static int VBurstIovBytes (const vburst_iov_t* iov, const int iovcnt)
+{
+    int bytesize = 0;
+
+    for (int idx = 0; idx < iovcnt; idx++)
+    {
+        bytesize += iov[idx].len;
+    }
+
+    return bytesize;
+}
+
+// -------------------------------------------------------------------------
+// VBurstSendBuf()
+//
+// Build a burst message of bytesize bytes in the node's send buffer,
+// with data in burst buffer bank.
+//
+// -------------------------------------------------------------------------
+
+static psend_buf_t VBurstSendBuf (const burst_hdr_t &hdr, const int burst_type, const int bytesize, const int bank, const uint32_t node)
+{
+    psend_buf_t psbuf = VExchSendBuf(node);
+
+    psbuf->type            = hdr.type;
+    psbuf->addr            = hdr.addr;
+    psbuf->prot            = hdr.prot;
+    psbuf->op              = (addr_bus_trans_op_t)hdr.op;
+    psbuf->num_burst_bytes = bytesize;
+    psbuf->buf_sel         = bank;
+
+    if (hdr.burst_type_in_data)
+    {
+        psbuf->param              = hdr.param;
+        *((uint32_t*)psbuf->data) = burst_type; // Re-use data field of send buffer for burst sub-operation
+    }
+    else
+    {
+        psbuf->param              = burst_type;
+    }
+
+    return psbuf;
+}
+
+// -------------------------------------------------------------------------
+// VBurstSingle()
+//
+// Exchange a burst message that fits in a single burst buffer, with
+// the first num_of_wr_bytes of the data segments gathered as its write
+// data.
+//
+// -------------------------------------------------------------------------
+
+static prcv_buf_t VBurstSingle (const burst_hdr_t &hdr, const int burst_type, const vburst_iov_t* iov, const int iovcnt, const int num_of_wr_bytes, const int bytesize, const uint32_t node)
+{
+    psend_buf_t psbuf = VBurstSendBuf(hdr, burst_type, bytesize, 0, node);
+
+    if (num_of_wr_bytes > 0)
+    {
+        VBurstGather(psbuf->databuf[0], iov, iovcnt, 0, num_of_wr_bytes);
+    }
+
+    return VExch(node);
+}
+
+// -------------------------------------------------------------------------
+// VBurstPushChunks()
+//
+// Send bytesize bytes of the data segments to the simulation as a
+// sequence of burst buffer sized chunks, of burst_type BURST_DATA (push)
+// or BURST_FIFO_CHECK. Each chunk after the first is gathered into the
+// alternate buffer bank whilst the simulation processes the previous
+// one.
+//
+// -------------------------------------------------------------------------
+
+static void VBurstPushChunks (const burst_hdr_t &hdr, const int burst_type, const vburst_iov_t* iov, const int iovcnt, const int bytesize, const uint32_t node)
+{
+    int bank   = 0;
+    int offset = 0;
+    int len    = std::min(bytesize, DATABUF_SIZE);
+
+    VBurstGather(ns[node]->send_buf.databuf[bank], iov, iovcnt, 0, len);
+
+    while (offset < bytesize)
+    {
+        VBurstSendBuf(hdr, burst_type, len, bank, node);
+        VExchPost(node);
+
+        // Stage the next chunk whilst the simulation consumes this one
+        int next    = offset + len;
+        int nextlen = std::min(bytesize - next, DATABUF_SIZE);
+
+        if (nextlen > 0)
+        {
+            VBurstGather(ns[node]->send_buf.databuf[bank ^ 1], iov, iovcnt, next, nextlen);
+        }
+
+        VExchWait(node);
+
+        offset = next;
+        len    = nextlen;
+        bank  ^= 1;
+    }
+}
+
+// -------------------------------------------------------------------------
+// VBurstPopChunks()
+//
+// Fetch bytesize bytes of data from the simulation, to the data
+// segments, as a sequence of burst buffer sized BURST_DATA (pop) chunks.
+// The request for each chunk after the first is sent, to fill the
+// alternate buffer bank, before the previous chunk is scattered out.
+// Returns the status of the first chunk.
+//
+// -------------------------------------------------------------------------
+
+static int VBurstPopChunks (const burst_hdr_t &hdr, const vburst_iov_t* iov, const int iovcnt, const int bytesize, const uint32_t node)
+{
+    int bank   = 0;
+    int offset = 0;
+    int len    = std::min(bytesize, DATABUF_SIZE);
+    int status = 0;
+
+    VBurstSendBuf(hdr, BURST_DATA, len, bank, node);
+    VExchPost(node);
+
+    while (offset < bytesize)
+    {
+        prcv_buf_t prbuf = VExchWait(node);
+
+        if (offset == 0)
+        {
+            status = prbuf->status;
+        }
+
+        // Request the next chunk before scattering out this one
+        int next    = offset + len;
+        int nextlen = std::min(bytesize - next, DATABUF_SIZE);
+
+        if (nextlen > 0)
+        {
+            VBurstSendBuf(hdr, BURST_DATA, nextlen, bank ^ 1, node);
+            VExchPost(node);
+        }
+
+        VBurstScatter(ns[node]->rcv_buf.databuf[bank], iov, iovcnt, offset, len);
+
+        offset = next;
+        len    = nextlen;
+        bank  ^= 1;
+    }
+
+    return status;
+}
+
+// -------------------------------------------------------------------------
+// VBurstChunked()
+//
+// Exchange a burst with more data than fits in a burst buffer, as a
+// pure burst transaction and a sequence of data chunks pushed to, or
+// popped from, the burst FIFO. is_get selects a transaction returning
+// data. Returns the status of the initial exchange for a get, else of
+// the last exchange.
+//
+// -------------------------------------------------------------------------
+
+static int VBurstChunked (const burst_hdr_t &hdr, const int burst_type, const bool is_get, const vburst_iov_t* iov, const int iovcnt, const int bytesize, const uint32_t node)
+{
+    switch (burst_type)
+    {
+    case BURST_NORM:
+        if (is_get)
+        {
+            int status = VBurstSingle(hdr, BURST_TRANS, NULL, 0, 0, bytesize, node)->status;
+            VBurstPopChunks(hdr, iov, iovcnt, bytesize, node);
+            return status;
+        }
+        else
+        {
+            VBurstPushChunks(hdr, BURST_DATA, iov, iovcnt, bytesize, node);
+            VBurstSingle(hdr, BURST_TRANS, NULL, 0, 0, bytesize, node);
+        }
+        break;
+
+    case BURST_DATA:
+        if (is_get)
+        {
+            return VBurstPopChunks(hdr, iov, iovcnt, bytesize, node);
+        }
+        else
+        {
+            VBurstPushChunks(hdr, BURST_DATA, iov, iovcnt, bytesize, node);
+        }
+        break;
+
+    case BURST_DATA_CHECK:
+        VBurstSingle(hdr, BURST_TRANS, NULL, 0, 0, bytesize, node);
+        VBurstPushChunks(hdr, BURST_FIFO_CHECK, iov, iovcnt, bytesize, node);
+        break;
+
+    case BURST_FIFO_CHECK:
+        VBurstPushChunks(hdr, BURST_FIFO_CHECK, iov, iovcnt, bytesize, node);
+        break;
+
+    default:
+        printf("***Error: burst of %d bytes exceeds maximum of %d bytes for burst type %d (VBurstChunked)\n", bytesize, DATABUF_SIZE, burst_type);
+        exit(1);
+    }
+
+    return ns[node]->rcv_buf.status;
+}
+
+// -------------------------------------------------------------------------
+// VTransBurst()
+//
+// Common burst transaction exchange function, for any number of bytes,
+// in data segments. Returns the number of bytes transferred.
+//
+// -------------------------------------------------------------------------
+
+static int VTransBurst (const burst_hdr_t &hdr, const int param, const vburst_iov_t* iov, const int iovcnt, const int bytesize, const uint32_t node)
+{
+    VExchGuard  guard(node);
+
+    // Address bus burst writes invalidate any cached lines they overlap
+    if ((hdr.op == WRITE_BURST || hdr.op == ASYNC_WRITE_BURST) && (hdr.type == trans32_burst || hdr.type == trans64_burst) &&
+        ns[node]->cache.num_ranges != 0)
+    {
+        VCacheInvalidateLines(&ns[node]->cache, hdr.addr, bytesize);
+    }
+
+    // Flag when a FIFO fill (or check) operation
+    bool is_fill = param == BURST_INCR || param == BURST_INCR_PUSH || param == BURST_INCR_CHECK ||
+                   param == BURST_RAND || param == BURST_RAND_PUSH || param == BURST_RAND_CHECK;
+
+    // Flag when data is returned
+    bool is_get  = hdr.op == READ_BURST && (param == BURST_NORM || param == BURST_DATA);
+
+    if (is_fill || param == BURST_TRANS || bytesize <= DATABUF_SIZE)
+    {
+        // The number of write bytes is either 1, when a fill/check operation (with first bytes),
+        // or none when a pure burst transaction or returning data, or the same as the bytesize value.
+        int num_of_wr_bytes = is_fill ? 1 : (param == BURST_TRANS || is_get) ? 0 : bytesize;
+
+        prcv_buf_t prbuf = VBurstSingle(hdr, param, iov, iovcnt, num_of_wr_bytes, bytesize, node);
+
+        if (is_get)
+        {
+            VBurstScatter(prbuf->databuf[0], iov, iovcnt, 0, bytesize);
+        }
+    }
+    else
+    {
+        VBurstChunked(hdr, param, hdr.op == READ_BURST, iov, iovcnt, bytesize, node);
+    }
+
+    return bytesize;
+}
+
+// -------------------------------------------------------------------------
+// VTransBurstCommon()
+//
+// Common burst transaction exchange function (32-bit address)
+//
+// -------------------------------------------------------------------------
+
+int VTransBurstCommon (const int op, const int param, const uint32_t addr, uint8_t* data, const int bytesize, const int prot, const uint32_t node)
+{
+    burst_hdr_t  hdr = {op, trans32_burst, addr, prot, 0, false};
+    vburst_iov_t iov = {data, bytesize};
+
+    return VTransBurst(hdr, param, &iov, 1, bytesize, node);
+}
+
+// -------------------------------------------------------------------------
+// VTransBurstIovCommon()
+//
+// Common scatter-gather burst transaction exchange function (32-bit
+// address), with write data gathered from, or read data scattered to,
+// the data segments
+//
+// -------------------------------------------------------------------------
+
+int VTransBurstIovCommon (const int op, const int param, const uint32_t addr, const vburst_iov_t* iov, const int iovcnt, const int prot, const uint32_t node)
+{
+    burst_hdr_t hdr = {op, trans32_burst, addr, prot, 0, false};
+
+    return VTransBurst(hdr, param, iov, iovcnt, VBurstIovBytes(iov, iovcnt), node);
+}
+
+// -------------------------------------------------------------------------
+// VTransBurstCommon()
+//
+// Common burst transaction exchange function (64-bit address)
+//
+// -------------------------------------------------------------------------
+
+int VTransBurstCommon (const int op, const int param, const uint64_t addr, uint8_t* data, const int bytesize, const int prot, const uint32_t node)
+{
+    burst_hdr_t  hdr = {op, trans64_burst, addr, prot, 0, false};
+    vburst_iov_t iov = {data, bytesize};
+
+    return VTransBurst(hdr, param, &iov, 1, bytesize, node);
+}
+
+// -------------------------------------------------------------------------
+// VTransBurstIovCommon()
+//
+// Common scatter-gather burst transaction exchange function (64-bit
+// address), with write data gathered from, or read data scattered to,
+// the data segments
+//
+// -------------------------------------------------------------------------
+
+int VTransBurstIovCommon (const int op, const int param, const uint64_t addr, const vburst_iov_t* iov, const int iovcnt, const int prot, const uint32_t node)
+{
+    burst_hdr_t hdr = {op, trans64_burst, addr, prot, 0, false};
+
+    return VTransBurst(hdr, param, iov, iovcnt, VBurstIovBytes(iov, iovcnt), node);
+}
+
+// -------------------------------------------------------------------------
+// VTransGetCount
+//
+// Function to return various counts
+// -------------------------------------------------------------------------
+
+int VTransGetCount (const int op, const uint32_t node)
+{
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
+
+    psbuf->op              = (addr_bus_trans_op_t)op;
+
+    prcv_buf_t  prbuf = VExch(node);
+
+    return prbuf->count;
+
+}
+
+// -------------------------------------------------------------------------
+// VTransTransactionWait
+//
+// Function wait on transactions
+// -------------------------------------------------------------------------
+
+void VTransTransactionWait (const int op, const uint32_t node)
+{
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
+
+    psbuf->op              = (addr_bus_trans_op_t)op;
+
+    VExch(node);
+
+    return;
+}
+
+// -------------------------------------------------------------------------
+// VReadPollExch()
+//
+// Exchange a single read poll message, for the simulator to poll addr
+// for up to timeout reads (if non-zero), ending early on an interrupt
+// if irqstop is set. Must be called with the node's VExchGuard held.
+// The last read data is returned in data, the number of reads in
+// iterations, and whether interrupted in irq. Returns true if the data
+// matched.
+//
+// -------------------------------------------------------------------------
+
+static bool VReadPollExch (const uint64_t addr, const int addr_width, const int data_width, const uint64_t mask, const uint64_t expval,
+                           const int interval, const int timeout, const bool irqstop, uint64_t* data, int* iterations, bool* irq,
+                           const uint32_t node)
+{
+    psend_buf_t psbuf = VExchSendBuf(node);
+    uint64_t    descr[3] = {mask, (uint64_t)timeout, irqstop ? 1ULL : 0ULL};
+    uint32_t    result[3];
+    int         type;
+
+    // Transaction type of the address width, offset by the data width's log2 bytes
+    switch (data_width)
+    {
+        case 8:  type = 0; break;
+        case 16: type = 1; break;
+        case 32: type = 2; break;
+        default: type = 3; break;
+    }
+
+    psbuf->type            = (trans_type_e)(((addr_width == 64) ? trans64_byte : trans32_byte) + type);
+    psbuf->addr            = addr;
+    psbuf->op              = READ_POLL;
+    psbuf->param           = interval;
+    psbuf->num_burst_bytes = sizeof(descr);
+
+    // The expected value is sent as the write data, and the mask, timeout
+    // and stop on interrupt request in the burst data buffer
+    memcpy(psbuf->data, &expval, sizeof(expval));
+    memcpy(psbuf->databuf[psbuf->buf_sel], descr, sizeof(descr));
+
+    prcv_buf_t  prbuf = VExch(node);
+
+    // The number of reads, and whether matched or interrupted, are returned in the burst data buffer
+    memcpy(result, prbuf->databuf[psbuf->buf_sel], sizeof(result));
+
+    *data       = ((uint64_t)prbuf->data_in_hi << 32) | (uint64_t)prbuf->data_in;
+    *data      &= (data_width < 64) ? ((1ULL << data_width) - 1) : ~0ULL;
+    *iterations = (int)result[0];
+    *irq        = result[2] != 0;
+
+    return result[1] != 0;
+}
+
+// -------------------------------------------------------------------------
+// VTransReadPoll()
+//
+// Have the simulator repeatedly read addr, waiting interval clock
+// cycles before each read, until the read data bits selected by mask
+// match those of expval, or timeout reads have been made (if non-zero).
+// The last read data is returned in data, and the number of reads in
+// iterations. Returns true if the data matched.
+//
+// When an interrupt callback is registered, the simulator's poll ends on
+// an interrupt, so that the callback is run at the end of the exchange,
+// as for any other transaction, and the poll is then continued for the
+// remaining number of reads. If interrupted is not NULL, the poll is
+// instead returned from on an interrupt, with interrupted set, for the
+// caller to process the interrupt before polling again.
+//
+// -------------------------------------------------------------------------
+
+bool VTransReadPoll (const uint64_t addr, const int addr_width, const int data_width, const uint64_t mask, const uint64_t expval,
+                     const int interval, const int timeout, uint64_t* data, int* iterations, bool* interrupted, const uint32_t node)
+{
+    VExchGuard  guard(node);
+    bool        irqstop = interrupted != NULL || ns[node]->VIntVecCB != NULL;
+    int         total   = 0;
+    int         polls;
+    bool        irq;
+    bool        matched;
+
+    do
+    {
+        matched = VReadPollExch(addr, addr_width, data_width, mask, expval, interval, timeout ? timeout - total : 0, irqstop,
+                                data, &polls, &irq, node);
+        total  += polls;
+    }
+    while (!matched && irq && interrupted == NULL && (timeout == 0 || total < timeout));
+
+    *iterations = total;
+
+    if (interrupted != NULL)
+    {
+        *interrupted = irq;
+    }
+
+    return matched;
+}
+
+// -------------------------------------------------------------------------
+// VQueueDrain()
+//
+// Exchange a queue drain message, for the simulator to execute the
+// transactions in the node's submission queue, and then wait for ticks
+// clock cycles. Must be called with the node's VExchGuard held. Returns
+// the number of transactions still queued, which is always zero, as no
+// more transactions are queued than there is room for their completions.
+//
+// -------------------------------------------------------------------------
+
+static int VQueueDrain (const uint32_t node, const int ticks = 0)
+{
+    psend_buf_t psbuf = VExchSendBuf(node);
+
+    psbuf->op              = QUEUE_DRAIN;
+    psbuf->ticks           = ticks;
+
+    VExch(node);
+
+    return VQueueCount(&(ns[node]->queue.sq));
+}
+
+// -------------------------------------------------------------------------
+// VQueueTrans()
+//
+// Submit a single (non-burst) address bus transaction to the node's
+// submission queue, without a message exchange. Queued transactions are
+// executed in order by the simulator, all in one VTrans call, before
+// the next message exchange or when flushed. If the queue is full it is
+// flushed first. Returns false, without queuing the transaction, if the
+// completion queue has no room for its completion, when completions
+// need fetching with VQueueGetResp().
+//
+// -------------------------------------------------------------------------
+
+bool VQueueTrans (const int op, const uint64_t addr, const uint64_t data, const int addr_width, const int data_width, const uint32_t tag, const uint32_t node)
+{
+    VExchGuard     guard(node);
+    vqueue_trans_t trans = {tag, op, addr, data, addr_width, data_width, 0, false, NULL};
+
+    // Only single word write and read transactions can be queued
+    if (op < WRITE_OP || op > ASYNC_WRITE_AND_READ)
+    {
+        printf("***Error: operation %d cannot be queued on node %d (VQueueTrans)\n", op, node);
+        exit(1);
+    }
+
+    // Every queued transaction must have room for its completion, so that
+    // the simulator never stops draining with transactions left queued
+    if (ns[node]->queue.inflight == VP_QUEUE_SIZE)
+    {
+        return false;
+    }
+
+    if (!VQueuePush(&(ns[node]->queue.sq), trans))
+    {
+        VQueueDrain(node);
+        VQueuePush(&(ns[node]->queue.sq), trans);
+    }
+
+    VCacheWriteThrough(op, addr, data_width / 8, data, node);
+
+    ns[node]->queue.inflight++;
+
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// VQueueFlush()
+//
+// Have the simulator execute all the transactions in the node's
+// submission queue. Returns the number of transactions still queued,
+// which is always zero.
+//
+// -------------------------------------------------------------------------
+
+int VQueueFlush (const uint32_t node)
+{
+    VExchGuard  guard(node);
+
+    return VQueueDrain(node);
+}
+
+// -------------------------------------------------------------------------
+// VTransBatch()
+//
+// Execute an operation on each of num transaction records, in order,
+// through the node's submission queue, so that the simulator executes
+// them back-to-back, VP_QUEUE_SIZE per message exchange. Read data is
+// returned in the records' data fields. Any transactions already
+// queued are executed first. Batched transactions have no completions,
+// so every drain empties the queue. Returns the number of records
+// executed.
+//
+// -------------------------------------------------------------------------
+
+int VTransBatch (const int op, vbatch_trans_t* trans, const int num, const uint32_t node)
+{
+    VExchGuard     guard(node);
+    vqueue_trans_t qtrans;
+    bool           is_read = op >= READ_OP;
+    int            idx     = 0;
+
+    // Only single word write and read transactions can be batched
+    if (op < WRITE_OP || op > ASYNC_WRITE_AND_READ)
+    {
+        printf("***Error: operation %d cannot be batched on node %d (VTransBatch)\n", op, node);
+        exit(1);
+    }
 
-    VExch(&sbuf, &rbuf, node);
+    while (idx < num)
+    {
+        qtrans.tag        = idx;
+        qtrans.op         = op;
+        qtrans.addr       = trans[idx].addr;
+        qtrans.data       = trans[idx].data;
+        qtrans.addr_width = trans[idx].addr_width;
+        qtrans.data_width = trans[idx].data_width;
+        qtrans.prot       = trans[idx].prot;
+        qtrans.batch      = true;
+        qtrans.rdata      = is_read ? &trans[idx].data : NULL;
+
+        if (VQueuePush(&(ns[node]->queue.sq), qtrans))
+        {
+            VCacheWriteThrough(op, qtrans.addr, qtrans.data_width / 8, qtrans.data, node);
+            idx++;
+        }
+        else
+        {
+            VQueueDrain(node);
+        }
+    }
 
-    *status = rbuf.status;
-    *addr   = rbuf.addr_in;
+    VQueueDrain(node);
 
-    return rbuf.data_in & 0xffffU;
+    return idx;
 }
 
 // -------------------------------------------------------------------------
-// VTransUserCommon()
+// VReadFutureCheck()
 //
-// Common 32-bit word transaction exchange function (32-bit address)
+// Check that read future id has been issued, and that its data slot has
+// not been reused by a later future, exiting with an error if not
 //
 // -------------------------------------------------------------------------
 
-uint32_t VTransUserCommon (const int op, uint32_t *addr, const uint32_t data, int* status,  const int prot, const uint32_t node)
+static void VReadFutureCheck (const uint32_t id, const char* caller, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
-
-    sbuf.type            = trans32_word;
-    sbuf.addr            = *addr;
-    sbuf.prot            = prot;
-    sbuf.op              = (addr_bus_trans_op_t)op;
-
-    *((uint32_t*)sbuf.data) = data;
+    vfuture_t* f = &(ns[node]->queue.fut);
 
-    VExch(&sbuf, &rbuf, node);
-
-    *status = rbuf.status;
-    *addr   = rbuf.addr_in;
+    if ((int32_t)(f->issued - id) <= 0)
+    {
+        printf("***Error: read future %u not issued on node %d (%s)\n", id, node, caller);
+        exit(1);
+    }
 
-    return rbuf.data_in;
+    if (f->issued - id > VP_FUTURE_SIZE)
+    {
+        printf("***Error: read future %u on node %d is stale, with %u futures issued since (%s)\n",
+               id, node, f->issued - id - 1, caller);
+        exit(1);
+    }
 }
 
 // -------------------------------------------------------------------------
-// VTransUserCommon()
+// VReadFutureWaitLocked()
 //
-// Common 8-bit word transaction exchange function (64-bit address)
+// Wait for the read data of read future id, fetched by the simulator in
+// a single queue drain, along with that of any older futures. Must be
+// called with the node's VExchGuard held.
 //
 // -------------------------------------------------------------------------
 
-uint8_t VTransUserCommon (const int op, uint64_t *addr, const uint8_t data, int* status, const int prot, const uint32_t node)
+static uint64_t VReadFutureWaitLocked (const uint32_t id, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
-
-    sbuf.type            = trans64_byte;
-    sbuf.addr            = *addr;
-    sbuf.prot            = prot;
-    sbuf.op              = (addr_bus_trans_op_t)op;
+    vfuture_t* f = &(ns[node]->queue.fut);
 
-    *((uint8_t*)sbuf.data) = data & 0xffU;
-
-    VExch(&sbuf, &rbuf, node);
+    if ((int32_t)(id - f->completed) >= 0)
+    {
+        f->wait_until = id + 1;
 
-    *status = rbuf.status;
-    *addr   = ((uint64_t)rbuf.addr_in_hi << 32) | ((uint64_t)rbuf.addr_in);
+        if (VQueueDrain(node) != 0 || (int32_t)(id - f->completed) >= 0)
+        {
+            printf("***Error: read future %u not completed on node %d, with the completion queue full (VReadFutureWait)\n", id, node);
+            exit(1);
+        }
+    }
 
-    return rbuf.data_in & 0xffU;
+    return f->data[id & (VP_FUTURE_SIZE-1)];
 }
 
 // -------------------------------------------------------------------------
-// VTransUserCommon()
+// VReadFutureIssue()
 //
-// Common 16-bit word transaction exchange function (64-bit address)
+// Issue a read whose data is returned later, as a read future, by
+// queueing a read address phase, without a message exchange. Returns
+// the future's id. The read data of outstanding futures is fetched, in
+// order, whenever the queue is drained. If VP_FUTURE_SIZE futures are
+// outstanding the oldest is first waited for. A future's data is held
+// until VP_FUTURE_SIZE more futures are issued, after which its id is
+// stale and rejected.
 //
 // -------------------------------------------------------------------------
 
-uint16_t VTransUserCommon (const int op, uint64_t *addr, const uint16_t data, int* status, const int prot, const uint32_t node)
+uint32_t VReadFutureIssue (const uint64_t addr, const int addr_width, const int data_width, const int prot, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
+    VExchGuard     guard(node);
+    vfuture_t*     f     = &(ns[node]->queue.fut);
+    vqueue_trans_t trans = {0, ASYNC_READ_ADDRESS, addr, 0, addr_width, data_width, prot, true, NULL};
 
-    VInitSendBuf(sbuf);
-
-    sbuf.type            = trans64_hword;
-    sbuf.addr            = *addr;
-    sbuf.prot            = prot;
-    sbuf.op              = (addr_bus_trans_op_t)op;
+    if (f->issued - f->completed == VP_FUTURE_SIZE)
+    {
+        VReadFutureWaitLocked(f->completed, node);
+    }
 
-    *((uint16_t*)sbuf.data) = data & 0xffffU;
+    if (!VQueuePush(&(ns[node]->queue.sq), trans))
+    {
+        VQueueDrain(node);
 
-    VExch(&sbuf, &rbuf, node);
+        if (!VQueuePush(&(ns[node]->queue.sq), trans))
+        {
+            printf("***Error: read future not issued on node %d, with the completion queue full (VReadFutureIssue)\n", node);
+            exit(1);
+        }
+    }
 
-    *status = rbuf.status;
-    *addr   = ((uint64_t)rbuf.addr_in_hi << 32) | ((uint64_t)rbuf.addr_in);
+    f->width[f->issued & (VP_FUTURE_SIZE-1)] = data_width;
 
-    return rbuf.data_in & 0xffffU;
+    return f->issued++;
 }
 
 // -------------------------------------------------------------------------
-// VTransUserCommon()
+// VReadFutureReady()
 //
-// Common 32-bit word transaction exchange function (64-bit address)
+// Returns true if the read data of read future id has been returned.
+// If not, and no read data has been fetched since the last check, a
+// queue drain is exchanged to fetch any now available, without waiting
+// for it, followed by a clock cycle. So a loop polling ready() advances
+// the simulation.
 //
 // -------------------------------------------------------------------------
 
-uint32_t VTransUserCommon (const int op, uint64_t *addr, const uint32_t data, int* status, const int prot, const uint32_t node)
+bool VReadFutureReady (const uint32_t id, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
-
-    sbuf.type            = trans64_word;
-    sbuf.addr            = *addr;
-    sbuf.prot            = prot;
-    sbuf.op              = (addr_bus_trans_op_t)op;
+    VExchGuard  guard(node);
+    vfuture_t*  f = &(ns[node]->queue.fut);
 
-    *((uint32_t*)sbuf.data) = data;
+    VReadFutureCheck(id, "VReadFutureReady", node);
 
-    VExch(&sbuf, &rbuf, node);
+    if ((int32_t)(id - f->completed) >= 0 && f->completed == f->ready_mark)
+    {
+        VQueueDrain(node, 1);
+    }
 
-    *status = rbuf.status;
-    *addr   = ((uint64_t)rbuf.addr_in_hi << 32) | ((uint64_t)rbuf.addr_in);
+    f->ready_mark = f->completed;
 
-    return rbuf.data_in;
+    return (int32_t)(id - f->completed) < 0;
 }
 
 // -------------------------------------------------------------------------
-// VTransUserCommon()
+// VReadFutureWait()
 //
-// Common 64-bit word transaction exchange function (64-bit address)
+// Returns the read data of read future id, waiting for it if not yet
+// returned, with a single message exchange
 //
 // -------------------------------------------------------------------------
 
-uint64_t VTransUserCommon (const int op, uint64_t *addr, const uint64_t data, int* status, const int prot, const uint32_t node)
+uint64_t VReadFutureWait (const uint32_t id, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
-
-    sbuf.type            = trans64_dword;
-    sbuf.addr            = *addr;
-    sbuf.prot            = prot;
-    sbuf.op              = (addr_bus_trans_op_t)op;
-
-    *((uint64_t*)sbuf.data) = data;
+    VExchGuard  guard(node);
 
-    VExch(&sbuf, &rbuf, node);
+    VReadFutureCheck(id, "VReadFutureWait", node);
 
-    *status = rbuf.status;
-    *addr   = ((uint64_t)rbuf.addr_in_hi << 32) | ((uint64_t)rbuf.addr_in);
-
-    return (uint64_t)rbuf.data_in | ((uint64_t)rbuf.data_in_hi << 32);
+    return VReadFutureWaitLocked(id, node);
 }
 
 // -------------------------------------------------------------------------
-// VTransBurstCommon()
+// VCacheAddRange()
 //
-// Common burst transaction exchange function (32-bit address)
+// Declare the size bytes at addr as cacheable, with reads in the range
+// served from the node's cache. Returns false if there are already
+// VP_CACHE_RANGES ranges.
 //
 // -------------------------------------------------------------------------
 
-void VTransBurstCommon (const int op, const int param, const uint32_t addr, uint8_t* data, const int bytesize, const int prot, const uint32_t node)
+bool VCacheAddRange (const uint64_t addr, const uint64_t size, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
+    VExchGuard  guard(node);
+    vcache_t*   c = &ns[node]->cache;
 
-    sbuf.type            = trans32_burst;
-    sbuf.addr            = addr;
-    sbuf.prot            = prot;
-    sbuf.op              = (addr_bus_trans_op_t)op;
-    sbuf.param           = param;
-    sbuf.num_burst_bytes = bytesize % DATABUF_SIZE;
-
-    // Flag when a FIFO fill (or check) operation
-    bool is_fill = param == BURST_INCR || param == BURST_INCR_PUSH || param == BURST_INCR_CHECK ||
-                   param == BURST_RAND || param == BURST_RAND_PUSH || param == BURST_RAND_CHECK;
-
-    // The number of write bytes is either 1, when a fill/check operation (with first bytes),
-    // or none when a pure burst transaction or the same as the bytesize value.
-    int num_of_wr_bytes = is_fill ? 1 : (param == BURST_TRANS) ? 0 : sbuf.num_burst_bytes;
-
-    for (int idx = 0; idx < num_of_wr_bytes; idx++)
+    if (c->num_ranges == VP_CACHE_RANGES)
     {
-        sbuf.databuf[idx] = data[idx];
+        VPrint("***Error: no more than %d cacheable ranges on node %d (VCacheAddRange)\n", VP_CACHE_RANGES, node);
+        return false;
     }
 
-    VExch(&sbuf, &rbuf, node);
-
-    if (op == READ_BURST && param != BURST_TRANS && !is_fill)
-    {
-        for (int idx = 0; idx < sbuf.num_burst_bytes; idx++)
-        {
-            data[idx] = rbuf.databuf[idx];
-        }
-    }
+    c->range[c->num_ranges].base = addr;
+    c->range[c->num_ranges].size = size;
+    c->num_ranges++;
 
-    return;
+    return true;
 }
 
 // -------------------------------------------------------------------------
-// VTransBurstCommon()
+// VCacheClearRanges()
 //
-// Common burst transaction exchange function (64-bit address)
+// Remove all of the node's cacheable ranges, invalidating the cache
 //
 // -------------------------------------------------------------------------
 
-void VTransBurstCommon (const int op, const int param, const uint64_t addr, uint8_t* data, const int bytesize, const int prot, const uint32_t node)
+void VCacheClearRanges (const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
-
-    sbuf.type            = trans64_burst;
-    sbuf.addr            = addr;
-    sbuf.prot            = prot;
-    sbuf.op              = (addr_bus_trans_op_t)op;
-    sbuf.param           = param;
-    sbuf.num_burst_bytes = bytesize % DATABUF_SIZE;
-
-    // Flag when a FIFO fill (or check) operation
-    bool is_fill = param == BURST_INCR || param == BURST_INCR_PUSH || param == BURST_INCR_CHECK ||
-                   param == BURST_RAND || param == BURST_RAND_PUSH || param == BURST_RAND_CHECK;
-
-    // The number of write bytes is either 1, when a fill/check operation (with first bytes),
-    // or none when a pure burst transaction or the same as the bytesize value.
-    int num_of_wr_bytes = is_fill ? 1  : (param == BURST_TRANS) ? 0 : sbuf.num_burst_bytes;
-
-    for (int idx = 0; idx < num_of_wr_bytes; idx++)
-    {
-        sbuf.databuf[idx] = data[idx];
-    }
+    VExchGuard  guard(node);
 
-    VExch(&sbuf, &rbuf, node);
-
-    if (op == READ_BURST && param != BURST_TRANS)
-    {
-        for (int idx = 0; idx < sbuf.num_burst_bytes; idx++)
-        {
-            data[idx] = rbuf.databuf[idx];
-        }
-    }
-
-    return;
+    ns[node]->cache.num_ranges = 0;
+    VCacheInvalidateLines(&ns[node]->cache, 0, ~0ULL);
 }
 
 // -------------------------------------------------------------------------
-// VTransGetCount
+// VCacheInvalidate()
+//
+// Invalidate any of the node's cached lines overlapping the size bytes
+// at addr, for when cached memory is modified other than by this node's
+// single word writes and burst writes.
 //
-// Function to return various counts
 // -------------------------------------------------------------------------
 
-int VTransGetCount (const int op, const uint32_t node)
+void VCacheInvalidate (const uint64_t addr, const uint64_t size, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
+    VExchGuard  guard(node);
 
-    sbuf.op              = (addr_bus_trans_op_t)op;
+    VCacheInvalidateLines(&ns[node]->cache, addr, size);
+}
 
-    VExch(&sbuf, &rbuf, node);
+// -------------------------------------------------------------------------
+// VCacheGetStats()
+//
+// Get the number of the node's reads served from the cache, and the
+// number that missed and filled a line
+//
+// -------------------------------------------------------------------------
 
-    return rbuf.count;
+void VCacheGetStats (uint64_t* hits, uint64_t* misses, const uint32_t node)
+{
+    VExchGuard  guard(node);
 
+    *hits   = ns[node]->cache.hits;
+    *misses = ns[node]->cache.misses;
 }
 
 // -------------------------------------------------------------------------
-// VTransTransactionWait
+// VQueueGetResp()
+//
+// Fetch the tag, read data and status of the oldest completed queued
+// transaction. Returns false if there are none.
 //
-// Function wait on transactions
 // -------------------------------------------------------------------------
 
-void VTransTransactionWait (const int op, const uint32_t node)
+bool VQueueGetResp (uint32_t* tag, uint64_t* data, int* status, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
+    VExchGuard    guard(node);
+    vqueue_resp_t resp;
 
-    VInitSendBuf(sbuf);
+    if (!VQueuePop(&(ns[node]->queue.cq), &resp))
+    {
+        return false;
+    }
 
-    sbuf.op              = (addr_bus_trans_op_t)op;
+    ns[node]->queue.inflight--;
 
-    VExch(&sbuf, &rbuf, node);
+    *tag    = resp.tag;
+    *data   = resp.data;
+    *status = resp.status;
 
-    return;
+    return true;
 }
 
 // -------------------------------------------------------------------------
@@ -698,20 +1844,18 @@ void VTransTransactionWait (const int op, const uint32_t node)
 
 uint8_t VStreamUserCommon (const int op, const uint8_t data, const int param, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    sbuf.type            = stream_snd_byte;
-    sbuf.op              = (addr_bus_trans_op_t)op;
-    sbuf.param           = param;
+    psbuf->type            = stream_snd_byte;
+    psbuf->op              = (addr_bus_trans_op_t)op;
+    psbuf->param           = param;
 
-    *((uint8_t*)sbuf.data) = data & 0xffU;
+    *((uint8_t*)psbuf->data) = data & 0xffU;
 
-    VExch(&sbuf, &rbuf, node);
+    prcv_buf_t  prbuf = VExch(node);
 
-    return rbuf.data_in & 0xffU;
+    return prbuf->data_in & 0xffU;
 }
 
 // -------------------------------------------------------------------------
@@ -723,27 +1867,25 @@ uint8_t VStreamUserCommon (const int op, const uint8_t data, const int param, co
 
 bool VStreamUserGetCommon (int op, uint8_t *rdata, int *status, const uint8_t wdata, const int param, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    VInitSendBuf(sbuf);
+    psbuf->type            = stream_get_byte;
+    psbuf->op              = (addr_bus_trans_op_t)op;
+    psbuf->param           = param;
 
-    sbuf.type            = stream_get_byte;
-    sbuf.op              = (addr_bus_trans_op_t)op;
-    sbuf.param           = param;
+    *((uint8_t*)psbuf->data) = wdata & 0xffU;
 
-    *((uint8_t*)sbuf.data) = wdata & 0xffU;
-
-    VExch(&sbuf, &rbuf, node);
+    prcv_buf_t  prbuf = VExch(node);
 
     if (op != TRY_CHECK)
     {
-        *status = rbuf.status;
-        *rdata = rbuf.data_in & 0xffU;
+        *status = prbuf->status;
+        *rdata = prbuf->data_in & 0xffU;
     }
 
     // Return available status (sent back in unused interrupt field)
-    return rbuf.interrupt;
+    return prbuf->interrupt;
 }
 
 // -------------------------------------------------------------------------
@@ -755,20 +1897,18 @@ bool VStreamUserGetCommon (int op, uint8_t *rdata, int *status, const uint8_t wd
 
 uint16_t VStreamUserCommon (const int op, const uint16_t data, const int param, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    sbuf.type            = stream_snd_hword;
-    sbuf.op              = (addr_bus_trans_op_t)op;
-    sbuf.param           = param;
+    psbuf->type            = stream_snd_hword;
+    psbuf->op              = (addr_bus_trans_op_t)op;
+    psbuf->param           = param;
 
-    *((uint16_t*)sbuf.data) = data & 0xffffU;
+    *((uint16_t*)psbuf->data) = data & 0xffffU;
 
-    VExch(&sbuf, &rbuf, node);
+    prcv_buf_t  prbuf = VExch(node);
 
-    return rbuf.data_in & 0xffffU;
+    return prbuf->data_in & 0xffffU;
 }
 
 // -------------------------------------------------------------------------
@@ -780,27 +1920,25 @@ uint16_t VStreamUserCommon (const int op, const uint16_t data, const int param,
 
 bool VStreamUserGetCommon (int op, uint16_t *rdata, int *status, const uint16_t wdata, const int param, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    VInitSendBuf(sbuf);
+    psbuf->type            = stream_get_hword;
+    psbuf->op              = (addr_bus_trans_op_t)op;
+    psbuf->param           = param;
 
-    sbuf.type            = stream_get_hword;
-    sbuf.op              = (addr_bus_trans_op_t)op;
-    sbuf.param           = param;
+    *((uint16_t*)psbuf->data) = wdata & 0xffffU;
 
-    *((uint16_t*)sbuf.data) = wdata & 0xffffU;
-
-    VExch(&sbuf, &rbuf, node);
+    prcv_buf_t  prbuf = VExch(node);
 
     if (op != TRY_CHECK)
     {
-        *status = rbuf.status;
-        *rdata = rbuf.data_in & 0xffffU;
+        *status = prbuf->status;
+        *rdata = prbuf->data_in & 0xffffU;
     }
 
     // Return available status (sent back in unused interrupt field)
-    return rbuf.interrupt;
+    return prbuf->interrupt;
 }
 
 // -------------------------------------------------------------------------
@@ -812,20 +1950,18 @@ bool VStreamUserGetCommon (int op, uint16_t *rdata, int *status, const uint16_t
 
 uint32_t VStreamUserCommon (const int op, const uint32_t data, const int param, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    sbuf.type            = stream_snd_word;
-    sbuf.op              = (addr_bus_trans_op_t)op;
-    sbuf.param           = param;
+    psbuf->type            = stream_snd_word;
+    psbuf->op              = (addr_bus_trans_op_t)op;
+    psbuf->param           = param;
 
-    *((uint32_t*)sbuf.data) = data & 0xffffffffU;
+    *((uint32_t*)psbuf->data) = data & 0xffffffffU;
 
-    VExch(&sbuf, &rbuf, node);
+    prcv_buf_t  prbuf = VExch(node);
 
-    return rbuf.data_in & 0xffffffffU;
+    return prbuf->data_in & 0xffffffffU;
 }
 
 
@@ -838,27 +1974,25 @@ uint32_t VStreamUserCommon (const int op, const uint32_t data, const int param,
 
 bool VStreamUserGetCommon (int op, uint32_t *rdata, int *status, const uint32_t wdata, const int param, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    VInitSendBuf(sbuf);
+    psbuf->type            = stream_get_word;
+    psbuf->op              = (addr_bus_trans_op_t)op;
+    psbuf->param           = param;
 
-    sbuf.type            = stream_get_word;
-    sbuf.op              = (addr_bus_trans_op_t)op;
-    sbuf.param           = param;
+    *((uint32_t*)psbuf->data) = wdata & 0xffffffffU;
 
-    *((uint32_t*)sbuf.data) = wdata & 0xffffffffU;
-
-    VExch(&sbuf, &rbuf, node);
+    prcv_buf_t  prbuf = VExch(node);
 
     if (op != TRY_CHECK)
     {
-        *status = rbuf.status;
-        *rdata = rbuf.data_in & 0xffffffffU;
+        *status = prbuf->status;
+        *rdata = prbuf->data_in & 0xffffffffU;
     }
 
     // Return available status (sent back in unused interrupt field)
-    return rbuf.interrupt;
+    return prbuf->interrupt;
 }
 
 // -------------------------------------------------------------------------
@@ -870,20 +2004,18 @@ bool VStreamUserGetCommon (int op, uint32_t *rdata, int *status, const uint32_t
 
 uint64_t VStreamUserCommon (const int op, const uint64_t data, const int param, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    sbuf.type            = stream_snd_dword;
-    sbuf.op              = (addr_bus_trans_op_t)op;
-    sbuf.param           = param;
+    psbuf->type            = stream_snd_dword;
+    psbuf->op              = (addr_bus_trans_op_t)op;
+    psbuf->param           = param;
 
-    *((uint64_t*)sbuf.data) = data;
+    *((uint64_t*)psbuf->data) = data;
 
-    VExch(&sbuf, &rbuf, node);
+    prcv_buf_t  prbuf = VExch(node);
 
-    return (uint64_t)rbuf.data_in | ((uint64_t)rbuf.data_in_hi << 32);
+    return (uint64_t)prbuf->data_in | ((uint64_t)prbuf->data_in_hi << 32);
 }
 
 // -------------------------------------------------------------------------
@@ -895,99 +2027,154 @@ uint64_t VStreamUserCommon (const int op, const uint64_t data, const int param,
 
 bool VStreamUserGetCommon (int op, uint64_t *rdata, int *status, const uint64_t wdata, const int param,  const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    VInitSendBuf(sbuf);
+    psbuf->type            = stream_get_dword;
+    psbuf->op              = (addr_bus_trans_op_t)op;
+    psbuf->param           = param;
 
-    sbuf.type            = stream_get_dword;
-    sbuf.op              = (addr_bus_trans_op_t)op;
-
-    VExch(&sbuf, &rbuf, node);
-
-    *((uint64_t*)sbuf.data) = wdata;
+    *((uint64_t*)psbuf->data) = wdata;
 
+    prcv_buf_t  prbuf = VExch(node);
 
     if (op != TRY_CHECK)
     {
-        *status = rbuf.status;
-        *rdata  = (uint64_t)rbuf.data_in | ((uint64_t)rbuf.data_in_hi << 32);
+        *status = prbuf->status;
+        *rdata  = (uint64_t)prbuf->data_in | ((uint64_t)prbuf->data_in_hi << 32);
     }
 
     // Return available status (sent back in unused interrupt field)
-    return rbuf.interrupt;
+    return prbuf->interrupt;
 }
 
 // -------------------------------------------------------------------------
-// VStreamUserBurstSendCommon()
+// VStreamBurstSend()
 //
-// Common function for Send/Check related stream transactions
+// Send/Check related stream burst transaction exchange, with data in
+// data segments
 // -------------------------------------------------------------------------
 
-bool VStreamUserBurstSendCommon (const int op, const int burst_type, uint8_t* data, const int bytesize, const int param, const uint32_t node)
+static bool VStreamBurstSend (const int op, const int burst_type, const vburst_iov_t* iov, const int iovcnt, const int bytesize, const int param, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
+    VExchGuard  guard(node);
 
-    VInitSendBuf(sbuf);
+    burst_hdr_t hdr     = {op, stream_snd_burst, 0, 0, param, true};
 
-    sbuf.type               = stream_snd_burst;
-    sbuf.op                 = (addr_bus_trans_op_t)op;
-    sbuf.num_burst_bytes    = bytesize % DATABUF_SIZE;
-    sbuf.param              = param;
-    *((uint32_t*)sbuf.data) = burst_type; // Re-use data field of send buffer for burst sub-operation
+    // Flag when a FIFO fill (or check) operation
+    bool        is_fill = burst_type == BURST_INCR || burst_type == BURST_INCR_PUSH || burst_type == BURST_INCR_CHECK ||
+                          burst_type == BURST_RAND || burst_type == BURST_RAND_PUSH || burst_type == BURST_RAND_CHECK;
 
-    // The number of write bytes is either 1, when a fill/check operation (with first bytes),
-    // or none when a pure burst transaction or the same as the bytesize value.
-    int num_of_wr_bytes = (burst_type == BURST_TRANS)                         ? 0 :
-                          (op == TRY_CHECK_BURST && burst_type != BURST_NORM) ? 1 :
-                                                                                sbuf.num_burst_bytes;
+    if (is_fill || burst_type == BURST_TRANS || bytesize <= DATABUF_SIZE)
+    {
+        // The number of write bytes is either 1, when a fill/check operation (with first bytes),
+        // or none when a pure burst transaction or the same as the bytesize value.
+        int num_of_wr_bytes = is_fill ? 1 : (burst_type == BURST_TRANS) ? 0 : bytesize;
 
-    for (int idx = 0; idx < num_of_wr_bytes; idx++)
+        VBurstSingle(hdr, burst_type, iov, iovcnt, num_of_wr_bytes, bytesize, node);
+    }
+    else if ((stream_operation_t)op == TRY_CHECK_BURST)
     {
-        sbuf.databuf[idx] = data[idx];
+        printf("***Error: try check burst of %d bytes exceeds maximum of %d bytes (VStreamBurstSend)\n", bytesize, DATABUF_SIZE);
+        exit(1);
+    }
+    else
+    {
+        VBurstChunked(hdr, burst_type, false, iov, iovcnt, bytesize, node);
     }
-
-    VExch(&sbuf, &rbuf, node);
-
 
     // Return available status (sent back in unused interrupt field)
-    return rbuf.interrupt;
+    return ns[node]->rcv_buf.interrupt;
 }
 
 // -------------------------------------------------------------------------
-// VStreamUserBurstGetCommon()
+// VStreamUserBurstSendCommon()
 //
-// Common function for Get related stream transactions
+// Common function for Send/Check related stream transactions
 // -------------------------------------------------------------------------
 
-bool VStreamUserBurstGetCommon (const int op, const int param, uint8_t* data, const int bytesize, int* status, const uint32_t node)
+bool VStreamUserBurstSendCommon (const int op, const int burst_type, uint8_t* data, const int bytesize, const int param, const uint32_t node)
 {
-    rcv_buf_t    rbuf;
-    send_buf_t   sbuf;
+    vburst_iov_t iov = {data, bytesize};
+
+    return VStreamBurstSend(op, burst_type, &iov, 1, bytesize, param, node);
+}
+
+// -------------------------------------------------------------------------
+// VStreamUserBurstSendIovCommon()
+//
+// Common function for scatter-gather Send/Check related stream
+// transactions, with data gathered from the data segments
+// -------------------------------------------------------------------------
 
-    VInitSendBuf(sbuf);
+bool VStreamUserBurstSendIovCommon (const int op, const int burst_type, const vburst_iov_t* iov, const int iovcnt, const int param, const uint32_t node)
+{
+    return VStreamBurstSend(op, burst_type, iov, iovcnt, VBurstIovBytes(iov, iovcnt), param, node);
+}
 
-    sbuf.type            = stream_get_burst;
-    sbuf.op              = (addr_bus_trans_op_t)op;
-    sbuf.num_burst_bytes = bytesize % DATABUF_SIZE;
-    sbuf.param           = param;
+// -------------------------------------------------------------------------
+// VStreamBurstGet()
+//
+// Get related stream burst transaction exchange, with data returned to
+// data segments
+// -------------------------------------------------------------------------
 
-    VExch(&sbuf, &rbuf, node);
+static bool VStreamBurstGet (const int op, const int param, const vburst_iov_t* iov, const int iovcnt, const int bytesize, int* status, const uint32_t node)
+{
+    VExchGuard  guard(node);
 
-    *status = rbuf.status;
+    burst_hdr_t hdr = {op, stream_get_burst, 0, 0, 0, false};
 
-    // Return data for normal/data transactions, but only if not a try with none available
-    if ((param == BURST_NORM || param == BURST_DATA) && !((stream_operation_t)sbuf.op == TRY_GET_BURST && !rbuf.interrupt))
+    if (param == BURST_TRANS || bytesize <= DATABUF_SIZE)
     {
-        for (int idx = 0; idx < sbuf.num_burst_bytes; idx++)
+        prcv_buf_t prbuf = VBurstSingle(hdr, param, NULL, 0, 0, bytesize, node);
+
+        // Return data for normal/data transactions, but only if not a try with none available
+        if ((param == BURST_NORM || param == BURST_DATA) && !((stream_operation_t)op == TRY_GET_BURST && !prbuf->interrupt))
         {
-            data[idx] = rbuf.databuf[idx];
+            VBurstScatter(prbuf->databuf[0], iov, iovcnt, 0, bytesize);
         }
+
+        *status = prbuf->status;
+    }
+    else if ((stream_operation_t)op == TRY_GET_BURST)
+    {
+        printf("***Error: try get burst of %d bytes exceeds maximum of %d bytes (VStreamBurstGet)\n", bytesize, DATABUF_SIZE);
+        exit(1);
+    }
+    else
+    {
+        // Status of the initial transaction, rather than of the last chunk
+        *status = VBurstChunked(hdr, param, true, iov, iovcnt, bytesize, node);
     }
 
     // Return available status (sent back in unused interrupt field)
-    return rbuf.interrupt;
+    return ns[node]->rcv_buf.interrupt;
+}
+
+// -------------------------------------------------------------------------
+// VStreamUserBurstGetCommon()
+//
+// Common function for Get related stream transactions
+// -------------------------------------------------------------------------
+
+bool VStreamUserBurstGetCommon (const int op, const int param, uint8_t* data, const int bytesize, int* status, const uint32_t node)
+{
+    vburst_iov_t iov = {data, bytesize};
+
+    return VStreamBurstGet(op, param, &iov, 1, bytesize, status, node);
+}
+
+// -------------------------------------------------------------------------
+// VStreamUserBurstGetIovCommon()
+//
+// Common function for scatter-gather Get related stream transactions,
+// with data scattered to the data segments
+// -------------------------------------------------------------------------
+
+bool VStreamUserBurstGetIovCommon (const int op, const int param, const vburst_iov_t* iov, const int iovcnt, int* status, const uint32_t node)
+{
+    return VStreamBurstGet(op, param, iov, iovcnt, VBurstIovBytes(iov, iovcnt), status, node);
 }
 
 // -------------------------------------------------------------------------
@@ -999,17 +2186,15 @@ bool VStreamUserBurstGetCommon (const int op, const int param, uint8_t* data, co
 
 int VStreamWaitGetCount (const int op, const bool txnrx, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    VInitSendBuf(sbuf);
+    psbuf->op                = (addr_bus_trans_op_t)op;
+    *((uint32_t*)psbuf->data) = txnrx ? 1 : 0;
 
-    sbuf.op                = (addr_bus_trans_op_t)op;
-    *((uint32_t*)sbuf.data) = txnrx ? 1 : 0;
+    prcv_buf_t  prbuf = VExch(node);
 
-    VExch(&sbuf, &rbuf, node);
-
-    return txnrx ? rbuf.countsec : rbuf.count;
+    return txnrx ? prbuf->countsec : prbuf->count;
 }
 
 // -------------------------------------------------------------------------
@@ -1021,29 +2206,35 @@ int VStreamWaitGetCount (const int op, const bool txnrx, const uint32_t node)
 
 int VTick (const uint32_t ticks, const bool done, const bool error, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
-
-    // Ensure the tick loop executes at least once to allow donr and/or error to be
+    // Ensure the tick loop executes at least once to allow done and/or error to be
     // set with a tick argument of 0.
-    int loops = ticks ? ticks : 1;
+    int remaining = ticks ? ticks : 1;
+    int idx       = 0;
 
-    for (int idx = 0; idx < loops; idx++)
+    while (remaining > 0)
     {
-        // Loop, ticking once, to allow for interrupts to be registered while sleeping
-        sbuf.ticks       = ticks ? 1 : 0;
+        VExchGuard  guard(node);
+        psend_buf_t psbuf = VExchSendBuf(node);
+
+        // Tick once, with the simulator counting down the rest of the ticks
+        // without a message exchange. The simulator returns early, with the
+        // ticks still remaining, if there are interrupt events to drain, to
+        // allow for interrupts to be registered while sleeping.
+        psbuf->ticks       = ticks ? 1 : 0;
+        psbuf->tick_count  = remaining - 1;
 
         // Only flag the done and error status on the first tick.
-        sbuf.done        = (done  && (idx == 0)) ? 1 : 0;
-        sbuf.error       = (error && (idx == 0)) ? 1 : 0;
+        psbuf->done        = (done  && (idx == 0)) ? 1 : 0;
+        psbuf->error       = (error && (idx == 0)) ? 1 : 0;
 
         // Operation is to wait for clock
-        sbuf.op          = WAIT_FOR_CLOCK;
+        psbuf->op          = WAIT_FOR_CLOCK;
 
         // Exchange the tick command with simulator code
-        VExch(&sbuf, &rbuf, node);
+        prcv_buf_t  prbuf = VExch(node);
+
+        remaining          = prbuf->ticks_remaining;
+        idx++;
     }
 
     return 0;
@@ -1064,28 +2255,162 @@ void VRegInterrupt (const pVUserInt_t func, const uint32_t node)
 }
 
 // -------------------------------------------------------------------------
-// VSetTestName()
+// VIrqDrain()
+//
+// Call the interrupt callback for each interrupt event raised by
+// VIrqVec and not yet drained, in order, returning the number of
+// events. For use by a dedicated ISR thread, with draining at each
+// message exchange disabled by VIrqSetExchDrain().
 //
-// Set the tests name to the string of characters in data
 // -------------------------------------------------------------------------
 
-void VSetTestName (const char* data, const int bytesize, const uint32_t node)
+int VIrqDrain (const uint32_t node)
+{
+    return VIrqDrainEvents(node);
+}
+
+// -------------------------------------------------------------------------
+// VIrqWait()
+//
+// As VIrqDrain(), but if there are no interrupt events, first sleep
+// until there are, or until woken by VIrqWakeWaiters(). Returns the
+// number of events, which is 0 if woken with none. For a dedicated ISR
+// thread, without it needing to poll.
+//
+// -------------------------------------------------------------------------
+
+int VIrqWait (const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
+    VIrqSleep(&(ns[node]->irq));
 
-    VInitSendBuf(sbuf);
+    return VIrqDrainEvents(node);
+}
 
-    sbuf.type            = trans_idle;
-    sbuf.op              = SET_TEST_NAME;
-    sbuf.num_burst_bytes = bytesize % DATABUF_SIZE;
+// -------------------------------------------------------------------------
+// VIrqWakeWaiters()
+//
+// Wake any thread sleeping in VIrqWait(), e.g. for an ISR thread to be
+// stopped
+//
+// -------------------------------------------------------------------------
+
+void VIrqWakeWaiters (const uint32_t node)
+{
+    VIrqWake(&(ns[node]->irq));
+}
+
+// -------------------------------------------------------------------------
+// VIrqSetExchDrain()
+//
+// Enable or disable the draining of interrupt events at each message
+// exchange. Draining is enabled by default.
+//
+// -------------------------------------------------------------------------
+
+void VIrqSetExchDrain (const bool enable, const uint32_t node)
+{
+    DebugVPrint("VIrqSetExchDrain(): at node %d, %s interrupt event draining at message exchanges\n",
+                node, enable ? "enabling" : "disabling");
+
+    ns[node]->irq.exch_drain.store(enable);
+}
+
+// -------------------------------------------------------------------------
+// VIrqEventTime()
+//
+// Returns the timestamp, as the node's VTrans call count, of the
+// interrupt event last drained. Valid in an interrupt callback.
+//
+// -------------------------------------------------------------------------
+
+uint64_t VIrqEventTime (const uint32_t node)
+{
+    return ns[node]->irq.cur_time;
+}
+
+// -------------------------------------------------------------------------
+// VPerfDump()
+//
+// Print the node's performance counters, if compiled in with
+// VP_PERF_COUNTERS. Also called by the simulator when the user code
+// flags that it is done.
+//
+// -------------------------------------------------------------------------
+
+void VPerfDump (const uint32_t node)
+{
+#if defined(VP_PERF_COUNTERS)
+    const vperf_t* p      = &(ns[node]->perf);
+    double         scale  = VPerfNsPerTick(p);
+    double         user   = p->user_ticks   * scale;
+    double         hshake = p->hshake_ticks * scale;
+    double         sim    = p->sim_ticks    * scale;
+    double         total  = user + hshake + sim;
+
+    if (total == 0.0)
+    {
+        total = 1.0;
+    }
+
+    VPrint("VPerfDump(): node %d\n", node);
+    VPrint("  exchanges        : %llu\n", (unsigned long long)p->exchanges);
+    VPrint("  user code        : %12.3f ms (%5.1f%%)\n", user   / 1e6, 100.0 * user   / total);
+    VPrint("  handshake        : %12.3f ms (%5.1f%%)\n", hshake / 1e6, 100.0 * hshake / total);
+    VPrint("  simulator        : %12.3f ms (%5.1f%%)\n", sim    / 1e6, 100.0 * sim    / total);
+    VPrint("  burst bytes      : %llu\n", (unsigned long long)p->burst_bytes);
+
+    for (int op = 0; op < VPERF_NUM_OPS; op++)
+    {
+        if (p->op_count[op])
+        {
+            VPrint("  op %3d%-11s: %llu\n", op, op == VPERF_NUM_OPS-1 ? "+" : "", (unsigned long long)p->op_count[op]);
+        }
+    }
+
+    for (int type = 0; type < VPERF_NUM_TYPES; type++)
+    {
+        if (p->type_count[type])
+        {
+            VPrint("  type %3d%-9s: %llu\n", type, "", (unsigned long long)p->type_count[type]);
+        }
+    }
+
+    VPrint("  handshake latency histogram:\n");
 
-    for (int idx = 0; idx < sbuf.num_burst_bytes; idx++)
+    for (int bucket = 0; bucket < VPERF_HIST_BUCKETS; bucket++)
     {
-        sbuf.databuf[idx] = data[idx];
+        if (p->hist[bucket])
+        {
+            VPrint("    %10.0f ns to %10.0f ns : %llu\n", (double)(1ULL << bucket) * scale,
+                                                         (double)(2ULL << bucket) * scale,
+                                                         (unsigned long long)p->hist[bucket]);
+        }
     }
+#else
+    (void)node;
+
+    VPrint("VPerfDump(): performance counters not compiled in (compile with VP_PERF_COUNTERS defined)\n");
+#endif
+}
 
-    VExch(&sbuf, &rbuf, node);
+// -------------------------------------------------------------------------
+// VSetTestName()
+//
+// Set the tests name to the string of characters in data
+// -------------------------------------------------------------------------
+
+void VSetTestName (const char* data, const int bytesize, const uint32_t node)
+{
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
+
+    psbuf->type            = trans_idle;
+    psbuf->op              = SET_TEST_NAME;
+    psbuf->num_burst_bytes = bytesize % DATABUF_SIZE;
+
+    memcpy(psbuf->databuf[0], data, psbuf->num_burst_bytes);
+
+    VExch(node);
 
     return;
 }
@@ -1098,18 +2423,16 @@ void VSetTestName (const char* data, const int bytesize, const uint32_t node)
 
 void VSetModelOptions (const int option, const int optval, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    sbuf.type           = trans_idle;
-    sbuf.op             = SET_MODEL_OPTIONS;
-    sbuf.param          = option;
+    psbuf->type           = trans_idle;
+    psbuf->op             = SET_MODEL_OPTIONS;
+    psbuf->param          = option;
 
-    *((int*)sbuf.data)  = optval;
+    *((int*)psbuf->data)  = optval;
 
-    VExch(&sbuf, &rbuf, node);
+    VExch(node);
 }
 
 // -------------------------------------------------------------------------
@@ -1120,38 +2443,34 @@ void VSetModelOptions (const int option, const int optval, const uint32_t node)
 
 void VGetModelOptions (const int option, int &optval, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    VInitSendBuf(sbuf);
+    psbuf->type           = trans_idle;
+    psbuf->op             = GET_MODEL_OPTIONS;
+    psbuf->param          = option;
 
-    sbuf.type           = trans_idle;
-    sbuf.op             = GET_MODEL_OPTIONS;
-    sbuf.param          = option;
-
-    VExch(&sbuf, &rbuf, node);
+    prcv_buf_t  prbuf = VExch(node);
 
     // Option value is returned in the count field
     // containing the IntToModel value.
-    optval = rbuf.count;
+    optval = prbuf->count;
 }
 
 void VGetModelOptions (const int option, bool &optval, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    sbuf.type           = trans_idle;
-    sbuf.op             = GET_MODEL_OPTIONS;
-    sbuf.param          = option;
+    psbuf->type           = trans_idle;
+    psbuf->op             = GET_MODEL_OPTIONS;
+    psbuf->param          = option;
 
-    VExch(&sbuf, &rbuf, node);
+    prcv_buf_t  prbuf = VExch(node);
 
     // Option value is returned in the status field
     // containing the BoolToModel value.
-    optval = rbuf.status;
+    optval = prbuf->status;
 }
 
 // -------------------------------------------------------------------------
@@ -1162,17 +2481,15 @@ void VGetModelOptions (const int option, bool &optval, const uint32_t node)
 
 void VSetBurstMode (const int mode, const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    VInitSendBuf(sbuf);
+    psbuf->type           = trans_idle;
+    psbuf->op             = SET_BURST_MODE;
 
-    sbuf.type           = trans_idle;
-    sbuf.op             = SET_BURST_MODE;
+    *((int*)psbuf->data)  = mode;
 
-    *((int*)sbuf.data)  = mode;
-
-    VExch(&sbuf, &rbuf, node);
+    VExch(node);
 }
 
 // -------------------------------------------------------------------------
@@ -1183,19 +2500,17 @@ void VSetBurstMode (const int mode, const uint32_t node)
 
 int  VGetBurstMode (const uint32_t node)
 {
-    rcv_buf_t  rbuf;
-    send_buf_t sbuf;
-
-    VInitSendBuf(sbuf);
+    VExchGuard  guard(node);
+    psend_buf_t psbuf = VExchSendBuf(node);
 
-    sbuf.type           = trans_idle;
-    sbuf.op             = GET_BURST_MODE;
+    psbuf->type           = trans_idle;
+    psbuf->op             = GET_BURST_MODE;
 
-    VExch(&sbuf, &rbuf, node);
+    prcv_buf_t  prbuf = VExch(node);
 
     // mode value is returned in the count field
     // containing the IntToModel value.
-    return rbuf.count;
+    return prbuf->count;
 }
 
 
@@ -15,6 +15,15 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   ????.??    Added VIrqWait and VIrqWakeWaiters
+//    10/2026   ????.??    VTransBurstCommon returns the number of bytes transferred
+//                         and added transaction queue and performance
+//                         counter dump functions, VWaitForSim timeout,
+//                         batched transactions, read futures, HDL side
+//                         read polling, ended early by interrupts if
+//                         requested, user side read cache, scatter-gather
+//                         bursts, interrupt event queue draining, and include
+//                         of OsvvmVUserVPrint.h case corrected
 //    09/2025   ????.??    Added support for Set- & Get- burst mode and model options
 //    05/2023   2023.05    Adding support for Async, Try and Check transactions
 //                         and address bus repsonder
@@ -50,7 +59,7 @@
 
 #include "OsvvmVProc.h"
 #include "OsvvmVSchedPli.h"
-#include "OsvvmVUserVprint.h"
+#include "OsvvmVUserVPrint.h"
 
 // -------------------------------------------------------------------------
 // DEFINES AND MACROS
@@ -72,6 +81,11 @@
 #define HUNDRED_MILLISECS       1000000
 #define FIVESEC_TIMEOUT         (50*HUNDRED_MILLISECS)
 
+// Time for VWaitForSim to wait for the simulator to initialise a node
+#ifndef VP_INIT_TIMEOUT_SECS
+#define VP_INIT_TIMEOUT_SECS    60
+#endif
+
 // -------------------------------------------------------------------------
 // TYPE DEFINITIONS
 // -------------------------------------------------------------------------
@@ -114,12 +128,40 @@ extern uint32_t  VTransUserCommon               (const int op, uint64_t *addr, c
 extern uint64_t  VTransUserCommon               (const int op, uint64_t *addr, const uint64_t data, int* status, const int prot = 0, const uint32_t node = 0);
 
 // Overloaded stream transaction functions for 32 and 64 bit architecture
-extern void      VTransBurstCommon              (const int op, const int param, const uint32_t addr, uint8_t* data, const int bytesize, const int prot = 0, const uint32_t node = 0);
-extern void      VTransBurstCommon              (const int op, const int param, const uint64_t addr, uint8_t* data, const int bytesize, const int prot = 0, const uint32_t node = 0);
+extern int       VTransBurstCommon              (const int op, const int param, const uint32_t addr, uint8_t* data, const int bytesize, const int prot = 0, const uint32_t node = 0);
+extern int       VTransBurstCommon              (const int op, const int param, const uint64_t addr, uint8_t* data, const int bytesize, const int prot = 0, const uint32_t node = 0);
+
+// Overloaded scatter-gather burst transaction functions, with data in an array of segments
+extern int       VTransBurstIovCommon           (const int op, const int param, const uint32_t addr, const vburst_iov_t* iov, const int iovcnt, const int prot = 0, const uint32_t node = 0);
+extern int       VTransBurstIovCommon           (const int op, const int param, const uint64_t addr, const vburst_iov_t* iov, const int iovcnt, const int prot = 0, const uint32_t node = 0);
 
 extern int       VTransGetCount                 (const int op, const uint32_t node = 0);
+
+// Read poll function, with the polling loop executed in the simulator
+extern bool      VTransReadPoll                 (const uint64_t addr, const int addr_width, const int data_width, const uint64_t mask, const uint64_t expval,
+                                                 const int interval, const int timeout, uint64_t* data, int* iterations, bool* interrupted = NULL,
+                                                 const uint32_t node = 0);
 extern void      VTransTransactionWait          (const int op, const uint32_t node = 0);
 
+// Transaction submission and completion queue functions
+extern bool      VQueueTrans                    (const int op, const uint64_t addr, const uint64_t data, const int addr_width, const int data_width, const uint32_t tag = 0, const uint32_t node = 0);
+extern int       VQueueFlush                    (const uint32_t node = 0);
+extern bool      VQueueGetResp                  (uint32_t* tag, uint64_t* data, int* status, const uint32_t node = 0);
+
+// Batched transaction function, executing an operation on an array of transaction records
+extern int       VTransBatch                    (const int op, vbatch_trans_t* trans, const int num, const uint32_t node = 0);
+
+// Read future functions, for reads issued without waiting for their data
+extern uint32_t  VReadFutureIssue               (const uint64_t addr, const int addr_width, const int data_width, const int prot = 0, const uint32_t node = 0);
+extern bool      VReadFutureReady               (const uint32_t id, const uint32_t node = 0);
+extern uint64_t  VReadFutureWait                (const uint32_t id, const uint32_t node = 0);
+
+// User side read cache functions, for reads in declared cacheable address ranges
+extern bool      VCacheAddRange                 (const uint64_t addr, const uint64_t size, const uint32_t node = 0);
+extern void      VCacheClearRanges              (const uint32_t node = 0);
+extern void      VCacheInvalidate               (const uint64_t addr, const uint64_t size, const uint32_t node = 0);
+extern void      VCacheGetStats                 (uint64_t* hits, uint64_t* misses, const uint32_t node = 0);
+
 // Overloaded stream send/check common transaction functions for byte, half-word, word and double-word
 extern uint8_t   VStreamUserCommon              (const int op, const uint8_t   data, const int  param = 0,  const uint32_t node = 0);
 extern uint16_t  VStreamUserCommon              (const int op, const uint16_t  data, const int  param = 0,  const uint32_t node = 0);
@@ -135,6 +177,8 @@ extern bool      VStreamUserGetCommon           (const int op, uint64_t *rdata,
 // Stream burst send and get common transaction functions
 extern bool      VStreamUserBurstSendCommon     (const int op, const int burst_type, uint8_t* data, const int bytesize, const int param = 0, const uint32_t node = 0);
 extern bool      VStreamUserBurstGetCommon      (const int op, const int param,      uint8_t* data, const int bytesize, int* status,         const uint32_t node = 0);
+extern bool      VStreamUserBurstSendIovCommon  (const int op, const int burst_type, const vburst_iov_t* iov, const int iovcnt, const int param = 0, const uint32_t node = 0);
+extern bool      VStreamUserBurstGetIovCommon   (const int op, const int param,      const vburst_iov_t* iov, const int iovcnt, int* status,    const uint32_t node = 0);
 
 extern int       VStreamWaitGetCount            (const int op, const bool txnrx, const uint32_t node = 0);
 
@@ -144,4 +188,14 @@ extern int       VUser                          (const int node);
 // User interrupt callback registering function
 extern void      VRegInterrupt                  (const pVUserInt_t func, const uint32_t node);
 
+// Interrupt event queue functions, for events raised by VIrqVec
+extern int       VIrqDrain                      (const uint32_t node = 0);
+extern int       VIrqWait                       (const uint32_t node = 0);
+extern void      VIrqWakeWaiters                (const uint32_t node = 0);
+extern void      VIrqSetExchDrain               (const bool enable, const uint32_t node = 0);
+extern uint64_t  VIrqEventTime                  (const uint32_t node = 0);
+
+// Print the node's performance counters, when compiled with VP_PERF_COUNTERS
+extern void      VPerfDump                      (const uint32_t node = 0);
+
 #endif
@@ -10,10 +10,12 @@
 //
 //
 //  Description:
-//      OSVVM definition for VPrint, for PCIe model compatibility
+//      OSVVM definition for VPrint, for PCIe model compatibility. Except
+//      under Windows and Aldec, printed with the VLogPrint logging backend.
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   ????.??    VPrint uses the VLogPrint logging backend
 //    10/2025   ????.??    Initial revision
 //
 //
@@ -38,6 +40,8 @@
 #ifndef _OSVVM_VUSER_VPRINT_H_
 #define _OSVVM_VUSER_VPRINT_H_
 
+#include "OsvvmVLog.h"
+
 // -------------------------------------------------------------------------
 // DEFINES AND MACROS
 // -------------------------------------------------------------------------
@@ -59,7 +63,7 @@
                               printf (formbuf, ##__VA_ARGS__);                     \
                               }
 #  else
-#  define VPrint(...) {printf(__VA_ARGS__);}
+#  define VPrint(...) {VLogPrint(__VA_ARGS__);}
 #  endif
 # else
 #  define VPrint(...) {vhpi_printf(__VA_ARGS__);}
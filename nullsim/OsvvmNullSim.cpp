@@ -0,0 +1,1243 @@
+// =========================================================================
+//
+//  File Name:         OsvvmNullSim.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Defines the OsvvmNullSim class methods. Each node is called, as
+//      CoSimTrans or CoSimStream would be, with its VTrans outputs
+//      dispatched to either an address bus manager model of a memory
+//      shared by all the nodes, or a stream model with its transmitter
+//      looped back to its receiver. Each transaction takes a fixed
+//      number of virtual clock cycles.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Queue drains wait for their ticks
+//    10/2026   ????.??    Pool mode nodes collected in the same cycle
+//    10/2026   ????.??    Due nodes called in turn within a cycle
+//    10/2026   ????.??    Scripted interrupts optionally raised with VIrqVec
+//    10/2026   ????.??    Read polls ended by scripted interrupts, and scripted
+//                         read responses
+//    10/2026   ????.??    Added READ_POLL, and status of queued try operations
+//    10/2026   ????.??    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <algorithm>
+
+#include "OsvvmNullSim.h"
+
+// -------------------------------------------------------------------------
+// OsvvmNullSim()
+//
+// Constructor, with all nodes as address bus managers
+//
+// -------------------------------------------------------------------------
+
+OsvvmNullSim::OsvvmNullSim (const int num_nodes, const uint64_t max_cycles, const int latency, const bool verbose) :
+    nodes(num_nodes), irq_idx(0), cycle(0), max_cycles(max_cycles), latency(latency), verbose(verbose)
+{
+    for (auto &n : nodes)
+    {
+        n.stream       = false;
+        n.done         = false;
+        n.error        = false;
+        n.busy_until   = 0;
+        n.vtrans_calls = 0;
+        n.alerts       = 0;
+        n.irq          = 0;
+        n.rd_data      = 0;
+        n.status       = 0;
+        n.count        = 0;
+        n.countsec     = 0;
+        n.available    = false;
+        n.trans_count  = 0;
+        n.wr_count     = 0;
+        n.rd_count     = 0;
+        n.tx_count     = 0;
+        n.rx_count     = 0;
+        n.burst_mode   = 0;
+    }
+}
+
+// -------------------------------------------------------------------------
+// loadIrqScript()
+//
+// Load a script of interrupts, one per line as:
+//
+//   <cycle> <node> <vector> [irq]
+//
+// setting the node's interrupt vector input to VTrans from the given
+// cycle or, with irq, calling VIrqVec with the vector at that cycle, as
+// CoSimIrq would. Blank lines and those starting with # are ignored.
+// Returns -1 on error.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmNullSim::loadIrqScript (const char* filename)
+{
+    FILE* fp;
+    char  line[256];
+    int   lineno = 0;
+
+    if ((fp = fopen(filename, "r")) == NULL)
+    {
+        fprintf(stderr, "***Error: nullsim failed to open interrupt script %s\n", filename);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        unsigned long long cyc;
+        int                node, vec, fields;
+        char               first;
+        char               kind[8] = "";
+
+        lineno++;
+
+        if (sscanf(line, " %c", &first) != 1 || first == '#')
+        {
+            continue;
+        }
+
+        fields = sscanf(line, "%llu %i %i %7s", &cyc, &node, &vec, kind);
+
+        if (fields < 3 || (fields == 4 && strcmp(kind, "irq") != 0) || node < 0 || node >= (int)nodes.size())
+        {
+            fprintf(stderr, "***Error: nullsim bad interrupt script entry at %s:%d\n", filename, lineno);
+            fclose(fp);
+            return -1;
+        }
+
+        irq_events.push_back({cyc, node, vec, fields == 4});
+    }
+
+    fclose(fp);
+
+    std::stable_sort(irq_events.begin(), irq_events.end(),
+                     [](const irq_event_t &a, const irq_event_t &b) {return a.cycle < b.cycle;});
+
+    return 0;
+}
+
+// -------------------------------------------------------------------------
+// loadReadScript()
+//
+// Load a script of read responses, one per line as:
+//
+//   <node> <addr> <data>
+//
+// with the address and data in hexadecimal, and the node's reads of the address returning the data of each of
+// the address's lines in turn, as a test bench subordinate sending
+// read responses would, before returning the memory's contents. Blank
+// lines and those starting with # are ignored. Returns -1 on error.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmNullSim::loadReadScript (const char* filename)
+{
+    FILE* fp;
+    char  line[256];
+    int   lineno = 0;
+
+    if ((fp = fopen(filename, "r")) == NULL)
+    {
+        fprintf(stderr, "***Error: nullsim failed to open read script %s\n", filename);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        unsigned long long addr, data;
+        int                node;
+        char               first;
+
+        lineno++;
+
+        if (sscanf(line, " %c", &first) != 1 || first == '#')
+        {
+            continue;
+        }
+
+        if (sscanf(line, "%i %llx %llx", &node, &addr, &data) != 3 || node < 0 || node >= (int)nodes.size())
+        {
+            fprintf(stderr, "***Error: nullsim bad read script entry at %s:%d\n", filename, lineno);
+            fclose(fp);
+            return -1;
+        }
+
+        nodes[node].rd_script[addr].push_back(data);
+    }
+
+    fclose(fp);
+
+    return 0;
+}
+
+// -------------------------------------------------------------------------
+// getVTransCalls()
+//
+// Total number of VTrans calls over all the nodes
+//
+// -------------------------------------------------------------------------
+
+uint64_t OsvvmNullSim::getVTransCalls (void)
+{
+    uint64_t calls = 0;
+
+    for (auto &n : nodes)
+    {
+        calls += n.vtrans_calls;
+    }
+
+    return calls;
+}
+
+// -------------------------------------------------------------------------
+// run()
+//
+// Initialise all the nodes and call them until each has flagged done, or
+// the maximum number of cycles is reached. A node is called whenever its
+// last transaction has completed, as many times as needed in a cycle
+// for transactions that take no time, interleaved with the other nodes. Cycles where no node is due to be
+// called, and no interrupt changes, are skipped. Returns 0 if all nodes
+// finished without error.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmNullSim::run (void)
+{
+    for (int node = 0; node < (int)nodes.size(); node++)
+    {
+        VInit(node);
+    }
+
+    int active = nodes.size();
+
+    while (active && cycle < max_cycles)
+    {
+        // Apply the interrupts due this cycle
+        while (irq_idx < irq_events.size() && irq_events[irq_idx].cycle <= cycle)
+        {
+            if (irq_events[irq_idx].virq)
+            {
+                VIrqVec(irq_events[irq_idx].node, irq_events[irq_idx].vec);
+            }
+            else
+            {
+                nodes[irq_events[irq_idx].node].irq = irq_events[irq_idx].vec;
+            }
+            irq_idx++;
+        }
+
+        uint64_t next = max_cycles;
+        bool     due  = true;
+
+        // Call each due node once per pass, as an HDL simulator would in
+        // a delta cycle, until no node is due this cycle
+        while (due)
+        {
+            due = false;
+
+            for (int node = 0; node < (int)nodes.size(); node++)
+            {
+                node_t &n = nodes[node];
+
+                if (!n.done && n.busy_until <= cycle)
+                {
+                    callVTrans(node);
+
+                    if (n.done)
+                    {
+                        active--;
+                    }
+                    else
+                    {
+                        due |= n.busy_until <= cycle;
+                    }
+                }
+            }
+        }
+
+        for (auto &n : nodes)
+        {
+            if (!n.done)
+            {
+                next = std::min(next, n.busy_until);
+            }
+        }
+
+        if (irq_idx < irq_events.size())
+        {
+            next = std::min(next, irq_events[irq_idx].cycle);
+        }
+
+        if (active)
+        {
+            cycle = next;
+        }
+    }
+
+    int errors = 0;
+
+    for (int node = 0; node < (int)nodes.size(); node++)
+    {
+        if (!nodes[node].done)
+        {
+            fprintf(stderr, "***Error: nullsim node %d not done after %llu cycles\n", node, (unsigned long long)cycle);
+            errors++;
+        }
+        else if (nodes[node].error || nodes[node].alerts)
+        {
+            fprintf(stderr, "***Error: nullsim node %d finished with %s%d alerts\n",
+                    node, nodes[node].error ? "error flagged and " : "", nodes[node].alerts);
+            errors++;
+        }
+    }
+
+    return errors ? 1 : 0;
+}
+
+// -------------------------------------------------------------------------
+// callVTrans()
+//
+// Call VTrans for a node with the results of its last transaction, and
+// dispatch the new transaction, as for CoSimTrans or CoSimStream
+//
+// -------------------------------------------------------------------------
+
+void OsvvmNullSim::callVTrans (const int node)
+{
+    node_t &n = nodes[node];
+
+    int data     = (int)(n.rd_data & 0xffffffffULL);
+    int datahi   = (int)(n.rd_data >> 32);
+    int datawidth, addr, addrhi, addrwidth, op, burst_size, ticks, done, error, param;
+
+    // Stream interfaces send the receive available status in place of the interrupt vector
+    VTrans(node,  n.stream ? (n.available ? 1 : 0) : n.irq, n.status, n.count, n.countsec,
+           &data, &datahi,     &datawidth,
+           &addr, &addrhi,     &addrwidth,
+           &op,   &burst_size, &ticks,
+           &done, &error,      &param);
+
+    n.vtrans_calls++;
+
+    if (done)
+    {
+        n.done  = true;
+        n.error = error != 0;
+    }
+    else if (error)
+    {
+        alert(node, "error flagged by user code");
+    }
+
+    uint64_t wdata = ((uint64_t)(uint32_t)datahi << 32) | (uint32_t)data;
+    uint64_t waddr = ((uint64_t)(uint32_t)addrhi << 32) | (uint32_t)addr;
+    uint64_t cycles;
+
+    if (verbose)
+    {
+        printf("nullsim: %10llu node %d op %d addr 0x%llx data 0x%llx burst %d ticks %d param %d\n",
+               (unsigned long long)cycle, node, op, (unsigned long long)waddr, (unsigned long long)wdata, burst_size, ticks, param);
+    }
+
+    if (op == READ_POLL)
+    {
+        cycles = readPoll(node, waddr, addrwidth, wdata, datawidth, param);
+    }
+    else if (op >= SET_TEST_NAME)
+    {
+        cycles = (op == QUEUE_DRAIN) ? drainQueue(node) + (ticks > 0 ? ticks : 0) : 0;
+        cosimDispatch(node, op, burst_size);
+    }
+    else if (n.stream)
+    {
+        cycles = streamDispatch(node, op, wdata, datawidth, burst_size, ticks, param);
+    }
+    else
+    {
+        cycles = busDispatch(node, op, waddr, addrwidth, wdata, datawidth, burst_size, ticks, param);
+    }
+
+    n.busy_until = cycle + cycles;
+}
+
+// -------------------------------------------------------------------------
+// busDispatch()
+//
+// Execute an address bus manager transaction on the memory model,
+// returning the number of cycles taken
+//
+// -------------------------------------------------------------------------
+
+uint64_t OsvvmNullSim::busDispatch (const int node, const int op, const uint64_t addr_in, const int addr_width,
+                                    const uint64_t data, const int data_width,
+                                    const int burst_size, const int ticks, const int param)
+{
+    node_t   &n     = nodes[node];
+    uint64_t  addr  = (addr_width == 32) ? (addr_in & 0xffffffffULL) : addr_in;
+    int       bytes = data_width ? data_width / 8 : 4;
+    uint64_t  cycles;
+
+    if (op == WAIT_FOR_CLOCK)
+    {
+        return ticks > 0 ? ticks : 0;
+    }
+
+    cycles = latency + (ticks > 0 ? ticks : 0);
+
+    // All transactions and directives are counted by the OSVVM models, with
+    // writes and reads counted separately when they complete
+    n.trans_count++;
+
+    switch (op)
+    {
+    case NOT_DRIVEN:
+    case WAIT_FOR_TRANSACTION:
+    case WAIT_FOR_WRITE_TRANSACTION:
+    case WAIT_FOR_READ_TRANSACTION:
+    case GET_ALERTLOG_ID:
+        break;
+
+    case GET_TRANSACTION_COUNT:       n.count = n.trans_count; break;
+    case GET_WRITE_TRANSACTION_COUNT: n.count = n.wr_count;    break;
+    case GET_READ_TRANSACTION_COUNT:  n.count = n.rd_count;    break;
+
+    case SET_MODEL_OPTIONS:           n.options[param] = (int)data;    break;
+    case GET_MODEL_OPTIONS:           n.rd_data = n.options[param];    break;
+    case SET_BURST_MODE:              n.burst_mode = (int)data;        break;
+    case GET_BURST_MODE:              n.count = n.burst_mode;          break;
+
+    case WRITE_OP:
+    case ASYNC_WRITE:
+        memWrite(addr, data, bytes);
+        n.wr_count++;
+        break;
+
+    // Write a new value and read back the old
+    case WRITE_AND_READ:
+        n.rd_data = busRead(node, addr, bytes);
+        memWrite(addr, data, bytes);
+        n.wr_count++; n.rd_count++;
+        break;
+
+    case ASYNC_WRITE_AND_READ:
+        n.rd_data_q.push_back({busRead(node, addr, bytes), cycle});
+        memWrite(addr, data, bytes);
+        n.wr_count++;
+        break;
+
+    case WRITE_ADDRESS:
+    case ASYNC_WRITE_ADDRESS:
+        n.wr_addr_q.push_back(addr);
+        pairWritePhases(node);
+        break;
+
+    case WRITE_DATA:
+    case ASYNC_WRITE_DATA:
+        n.wr_data_q.push_back({data, bytes});
+        pairWritePhases(node);
+        break;
+
+    // Read data is returned in issue order, so a read with read address
+    // phases outstanding gets the data of the oldest
+    case READ_OP:
+    case ASYNC_READ:
+        n.rd_data_q.push_back({busRead(node, addr, bytes), cycle});
+        n.rd_data = n.rd_data_q.front().data;
+        n.rd_data_q.pop_front();
+        n.rd_count++;
+        break;
+
+    case READ_CHECK:
+        n.rd_data_q.push_back({busRead(node, addr, bytes), cycle});
+        n.rd_data = n.rd_data_q.front().data;
+        n.rd_data_q.pop_front();
+        n.rd_count++;
+
+        if (n.rd_data != (data & (bytes == 8 ? ~0ULL : ((1ULL << (bytes*8)) - 1))))
+        {
+            alert(node, "read check of 0x%llx got 0x%llx, expected 0x%llx",
+                  (unsigned long long)addr, (unsigned long long)n.rd_data, (unsigned long long)data);
+        }
+        break;
+
+    case READ_ADDRESS:
+    case ASYNC_READ_ADDRESS:
+        n.rd_data_q.push_back({busRead(node, addr, bytes), cycle});
+        n.rd_count++;
+        break;
+
+    case READ_DATA:
+    case ASYNC_READ_DATA:
+    case READ_DATA_CHECK:
+    case ASYNC_READ_DATA_CHECK:
+    {
+        // A try only gets read data with its address issued in an earlier cycle,
+        // whereas a blocking read waits for it
+        bool available = !n.rd_data_q.empty() &&
+                         (op == READ_DATA || op == READ_DATA_CHECK || n.rd_data_q.front().cycle < cycle);
+
+        // A blocking read of data never sent an address would hang, so flag it
+        if (!available && (op == READ_DATA || op == READ_DATA_CHECK))
+        {
+            alert(node, "read data without a read address");
+        }
+
+        n.status = available ? 1 : 0;
+
+        if (available)
+        {
+            n.rd_data = n.rd_data_q.front().data & (bytes == 8 ? ~0ULL : ((1ULL << (bytes*8)) - 1));
+            n.rd_data_q.pop_front();
+
+            if ((op == READ_DATA_CHECK || op == ASYNC_READ_DATA_CHECK) &&
+                n.rd_data != (data & (bytes == 8 ? ~0ULL : ((1ULL << (bytes*8)) - 1))))
+            {
+                alert(node, "read data check got 0x%llx, expected 0x%llx",
+                      (unsigned long long)n.rd_data, (unsigned long long)data);
+            }
+        }
+        break;
+    }
+
+    case WRITE_BURST:
+    case ASYNC_WRITE_BURST:
+        switch (param)
+        {
+        case BURST_NORM:
+        case BURST_DATA:
+            getBurstWrData(node, burst_size, n.wr_fifo);
+            break;
+        case BURST_INCR:
+        case BURST_INCR_PUSH:
+        case BURST_RAND:
+        case BURST_RAND_PUSH:
+            pushBurstPattern(node, param, burst_size, n.wr_fifo);
+            break;
+        case BURST_TRANS:
+            break;
+        default:
+            alert(node, "unsupported write burst type %d", param);
+            return cycles;
+        }
+
+        // Only write to memory when not a FIFO push operation
+        if (param != BURST_INCR_PUSH && param != BURST_RAND_PUSH && param != BURST_DATA)
+        {
+            if ((int)n.wr_fifo.size() < burst_size)
+            {
+                alert(node, "write burst of %d bytes with %d bytes in the write burst FIFO", burst_size, (int)n.wr_fifo.size());
+                break;
+            }
+
+            for (int idx = 0; idx < burst_size; idx++)
+            {
+                memWrite(addr + idx, n.wr_fifo.front(), 1);
+                n.wr_fifo.pop_front();
+            }
+
+            cycles += (burst_size + 7) / 8;
+            n.wr_count++;
+        }
+        break;
+
+    case READ_BURST:
+    {
+        std::vector<uint8_t> got;
+
+        // Read the burst from memory, unless popping data already read
+        if (param != BURST_DATA && param != BURST_INCR_CHECK && param != BURST_RAND_CHECK && param != BURST_FIFO_CHECK)
+        {
+            for (int idx = 0; idx < burst_size; idx++)
+            {
+                got.push_back((uint8_t)memRead(addr + idx, 1));
+            }
+
+            cycles += (burst_size + 7) / 8;
+            n.rd_count++;
+        }
+
+        switch (param)
+        {
+        case BURST_NORM:
+        case BURST_TRANS:
+        case BURST_DATA:
+            n.rd_fifo.insert(n.rd_fifo.end(), got.begin(), got.end());
+
+            if (param != BURST_TRANS)
+            {
+                setBurstRdData(node, burst_size, n.rd_fifo);
+            }
+            break;
+
+        case BURST_INCR_CHECK:
+        case BURST_RAND_CHECK:
+        case BURST_FIFO_CHECK:
+            got.clear();
+            for (int idx = 0; idx < burst_size && !n.rd_fifo.empty(); idx++)
+            {
+                got.push_back(n.rd_fifo.front());
+                n.rd_fifo.pop_front();
+            }
+            // fall through
+        case BURST_INCR:
+        case BURST_RAND:
+        case BURST_DATA_CHECK:
+        {
+            std::deque<uint8_t> exp;
+
+            if (param != BURST_DATA_CHECK && param != BURST_FIFO_CHECK)
+            {
+                pushBurstPattern(node, param, burst_size, exp);
+            }
+            else
+            {
+                getBurstWrData(node, burst_size, exp);
+            }
+
+            checkBurst(node, got, exp, burst_size);
+            break;
+        }
+
+        default:
+            alert(node, "unsupported read burst type %d", param);
+            break;
+        }
+        break;
+    }
+
+    default:
+        alert(node, "unsupported address bus operation %d", op);
+        break;
+    }
+
+    return cycles;
+}
+
+// -------------------------------------------------------------------------
+// streamDispatch()
+//
+// Execute a stream transaction, with data sent by the node's transmitter
+// looped back to its receiver. Returns the number of cycles taken.
+//
+// -------------------------------------------------------------------------
+
+uint64_t OsvvmNullSim::streamDispatch (const int node, const int op, const uint64_t data, const int data_width,
+                                       const int burst_size, const int ticks, const int param)
+{
+    node_t   &n     = nodes[node];
+    int       bytes = data_width ? data_width / 8 : 4;
+    uint64_t  mask  = (bytes == 8) ? ~0ULL : ((1ULL << (bytes*8)) - 1);
+    uint64_t  cycles;
+
+    if (op == WAIT_FOR_CLOCK)
+    {
+        return ticks > 0 ? ticks : 0;
+    }
+
+    cycles = latency + (ticks > 0 ? ticks : 0);
+
+    switch (op)
+    {
+    case NOT_DRIVEN:
+    case NULLSIM_STR_WAIT_FOR_TRANSACTION:
+        break;
+
+    case STR_GET_TRANSACTION_COUNT:
+        n.count    = n.rx_count;
+        n.countsec = n.tx_count;
+        break;
+
+    case NULLSIM_STR_SET_MODEL_OPTIONS: n.options[param] = (int)data;    break;
+    case NULLSIM_STR_GET_MODEL_OPTIONS: n.rd_data = n.options[param];    break;
+    case NULLSIM_STR_SET_BURST_MODE:    n.burst_mode = (int)data;        break;
+    case NULLSIM_STR_GET_BURST_MODE:    n.count = n.burst_mode;          break;
+
+    case SEND:
+    case SEND_ASYNC:
+        // Looped back, so received as soon as sent
+        n.wire_words.push_back({data & mask, param});
+        n.tx_count++;
+        n.rx_count++;
+        n.countsec = n.tx_count;
+        break;
+
+    case GET:
+    case TRY_GET:
+    case CHECK:
+    case TRY_CHECK:
+        n.available = !n.wire_words.empty();
+
+        // A blocking get with nothing sent would hang, so flag it
+        if (!n.available)
+        {
+            if (op == GET || op == CHECK)
+            {
+                alert(node, "stream get or check with no data sent");
+            }
+            break;
+        }
+
+        n.rd_data = n.wire_words.front().data & mask;
+        n.status  = n.wire_words.front().param;
+        n.wire_words.pop_front();
+        n.count   = n.rx_count;
+
+        if ((op == CHECK || op == TRY_CHECK) && n.rd_data != (data & mask))
+        {
+            alert(node, "stream check got 0x%llx, expected 0x%llx", (unsigned long long)n.rd_data, (unsigned long long)(data & mask));
+        }
+        break;
+
+    case GET_BURST:
+    case TRY_GET_BURST:
+        // Receive a burst into the receive FIFO, unless a pure pop operation
+        if (param != BURST_DATA)
+        {
+            n.available = !n.wire_bursts.empty();
+
+            if (!n.available)
+            {
+                if (op == GET_BURST)
+                {
+                    alert(node, "stream get burst with no burst sent");
+                }
+                break;
+            }
+
+            stream_burst_t &burst = n.wire_bursts.front();
+
+            n.rx_fifo.insert(n.rx_fifo.end(), burst.data.begin(), burst.data.end());
+            n.status  = burst.param;
+            cycles   += (burst.data.size() + 7) / 8;
+            n.wire_bursts.pop_front();
+            n.count   = n.rx_count;
+        }
+
+        if (param != BURST_TRANS)
+        {
+            setBurstRdData(node, burst_size, n.rx_fifo);
+        }
+        break;
+
+    case SEND_BURST:
+    case SEND_BURST_ASYNC:
+    case CHECK_BURST:
+    case TRY_CHECK_BURST:
+    {
+        bool                  is_check   = (op == CHECK_BURST || op == TRY_CHECK_BURST);
+        std::deque<uint8_t>  &fifo       = is_check ? n.rx_fifo : n.tx_fifo;
+        int                   burst_type = (int)data;
+
+        if (op == TRY_CHECK_BURST)
+        {
+            n.available = !n.wire_bursts.empty();
+
+            if (!n.available)
+            {
+                break;
+            }
+        }
+
+        // Fill the FIFO, if a push operation
+        switch (burst_type)
+        {
+        case BURST_NORM:
+        case BURST_DATA:
+            getBurstWrData(node, burst_size, fifo);
+            break;
+        case BURST_INCR:
+        case BURST_INCR_PUSH:
+        case BURST_INCR_CHECK:
+        case BURST_RAND:
+        case BURST_RAND_PUSH:
+        case BURST_RAND_CHECK:
+            pushBurstPattern(node, burst_type, burst_size, fifo);
+            break;
+        case BURST_TRANS:
+            break;
+        default:
+            alert(node, "unsupported stream burst type %d", burst_type);
+            return cycles;
+        }
+
+        // Send or check a burst of the FIFO data, unless a push operation
+        if (burst_type == BURST_DATA || burst_type == BURST_INCR_PUSH || burst_type == BURST_RAND_PUSH)
+        {
+            break;
+        }
+
+        if ((int)fifo.size() < burst_size)
+        {
+            alert(node, "stream burst of %d bytes with %d bytes in the burst FIFO", burst_size, (int)fifo.size());
+            break;
+        }
+
+        if (is_check)
+        {
+            if (n.wire_bursts.empty())
+            {
+                alert(node, "stream check burst with no burst sent");
+                break;
+            }
+
+            checkBurst(node, n.wire_bursts.front().data, fifo, burst_size);
+            n.wire_bursts.pop_front();
+            n.count = n.rx_count;
+        }
+        else
+        {
+            stream_burst_t burst;
+
+            burst.data.assign(fifo.begin(), fifo.begin() + burst_size);
+            burst.param = param;
+            fifo.erase(fifo.begin(), fifo.begin() + burst_size);
+            n.wire_bursts.push_back(std::move(burst));
+            n.tx_count++;
+            n.rx_count++;
+            n.countsec = n.tx_count;
+        }
+
+        cycles += (burst_size + 7) / 8;
+        break;
+    }
+
+    default:
+        alert(node, "unsupported stream operation %d", op);
+        break;
+    }
+
+    return cycles;
+}
+
+// -------------------------------------------------------------------------
+// cosimDispatch()
+//
+// Execute a co-simulation specific operation
+//
+// -------------------------------------------------------------------------
+
+void OsvvmNullSim::cosimDispatch (const int node, const int op, const int burst_size)
+{
+    switch (op)
+    {
+    case SET_TEST_NAME:
+        test_name.clear();
+
+        for (int idx = 0; idx < burst_size; idx++)
+        {
+            test_name += (char)getBurstWrByte(node, idx);
+        }
+
+        printf("nullsim: node %d test name %s\n", node, test_name.c_str());
+        break;
+
+    case QUEUE_DRAIN:
+        break;
+
+    // A pool mode node, collected by calling VTrans again in the same
+    // cycle, after the other due nodes have been dispatched
+    case POOL_COLLECT:
+        break;
+
+    default:
+        alert(node, "unsupported co-simulation operation %d", op);
+        break;
+    }
+}
+
+// -------------------------------------------------------------------------
+// drainQueue()
+//
+// Execute the transactions in the node's submission queue, as for
+// CoSimDrainQueue, returning the number of cycles taken
+//
+// -------------------------------------------------------------------------
+
+uint64_t OsvvmNullSim::drainQueue (const int node)
+{
+    node_t   &n      = nodes[node];
+    uint64_t  cycles = 0;
+    int       op, addr, addrhi, addrwidth, data, datahi, datawidth, valid;
+
+    while (VGetQueueTrans(node, &op, &addr, &addrhi, &addrwidth, &data, &datahi, &datawidth, &valid), valid)
+    {
+        cycles += busDispatch(node, op, ((uint64_t)(uint32_t)addrhi << 32) | (uint32_t)addr, addrwidth,
+                              ((uint64_t)(uint32_t)datahi << 32) | (uint32_t)data, datawidth, 0, 0, 0);
+
+        // Only try operations return a status, which is otherwise left set
+        VPutQueueResp(node, (int)(n.rd_data & 0xffffffffULL), (int)(n.rd_data >> 32),
+                      (op == ASYNC_READ_DATA || op == ASYNC_READ_DATA_CHECK) ? n.status : 1);
+    }
+
+    return cycles;
+}
+
+// -------------------------------------------------------------------------
+// readPoll()
+//
+// Read an address until the masked data matches, as for CoSimReadPoll,
+// returning the number of cycles taken. If requested, the poll ends
+// after a read that completes once a scripted interrupt of the node,
+// raised with VIrqVec or changing its interrupt input, is due. As the
+// memory model does not change during the poll, a poll that does not
+// match, with no maximum number of reads, scripted read responses or
+// interrupt to end it, is flagged.
+//
+// -------------------------------------------------------------------------
+
+uint64_t OsvvmNullSim::readPoll (const int node, const uint64_t addr, const int addr_width,
+                                 const uint64_t expval, const int data_width, const int interval)
+{
+    node_t   &n           = nodes[node];
+    uint64_t  raddr       = (addr_width == 32) ? (addr & 0xffffffffULL) : addr;
+    uint64_t  cycles      = 0;
+    int       polls       = 0;
+    int       interrupted = 0;
+    int       matched;
+    int       masklo, maskhi, maxpolls, irqstop, unused;
+
+    VGetBurstWrWord(node, 0,               &masklo,   &maskhi);
+    VGetBurstWrWord(node, 8,               &maxpolls, &unused);
+    VGetBurstWrWord(node, VP_POLL_IRQ_IDX, &irqstop,  &unused);
+
+    uint64_t  mask        = ((uint64_t)(uint32_t)maskhi << 32) | (uint32_t)masklo;
+
+    do
+    {
+        cycles += (interval > 0 ? interval : 0) + busDispatch(node, READ_OP, addr, addr_width, 0, data_width, 0, 0, 0);
+        polls++;
+        matched = ((n.rd_data ^ expval) & mask) == 0;
+
+        if (matched || (maxpolls > 0 && polls >= maxpolls))
+        {
+            break;
+        }
+
+        if (irqstop && irqDue(node, cycle + cycles))
+        {
+            interrupted = 1;
+            break;
+        }
+
+        if (maxpolls <= 0 && (n.rd_script.count(raddr) == 0 || n.rd_script[raddr].empty()) &&
+            !(irqstop && irqDue(node, UINT64_MAX)))
+        {
+            alert(node, "read poll of 0x%llx would never complete", (unsigned long long)addr);
+            break;
+        }
+    }
+    while (true);
+
+    VSetBurstRdWord(node, 0, polls,       matched);
+    VSetBurstRdWord(node, 8, interrupted, 0);
+
+    return cycles;
+}
+
+// -------------------------------------------------------------------------
+// irqDue()
+//
+// Whether a scripted interrupt of a node, not yet raised, is due by the
+// given cycle. Interrupt input events only count if they change the
+// node's interrupt input, as for an HDL gIntReq change.
+//
+// -------------------------------------------------------------------------
+
+bool OsvvmNullSim::irqDue (const int node, const uint64_t until)
+{
+    for (size_t idx = irq_idx; idx < irq_events.size() && irq_events[idx].cycle <= until; idx++)
+    {
+        if (irq_events[idx].node == node && (irq_events[idx].virq || irq_events[idx].vec != nodes[node].irq))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// -------------------------------------------------------------------------
+// busRead()
+//
+// Read data of an address bus read of a node, from its read script if
+// it has responses for the address, and otherwise from memory
+//
+// -------------------------------------------------------------------------
+
+uint64_t OsvvmNullSim::busRead (const int node, const uint64_t addr, const int bytes)
+{
+    std::unordered_map<uint64_t, std::deque<uint64_t> >::iterator it = nodes[node].rd_script.find(addr);
+
+    if (it == nodes[node].rd_script.end() || it->second.empty())
+    {
+        return memRead(addr, bytes);
+    }
+
+    uint64_t data = it->second.front() & (bytes == 8 ? ~0ULL : ((1ULL << (bytes*8)) - 1));
+
+    it->second.pop_front();
+
+    return data;
+}
+
+// -------------------------------------------------------------------------
+// pairWritePhases()
+//
+// Write to memory for each pair of queued write address and write data
+// phases, matched in order
+//
+// -------------------------------------------------------------------------
+
+void OsvvmNullSim::pairWritePhases (const int node)
+{
+    node_t &n = nodes[node];
+
+    while (!n.wr_addr_q.empty() && !n.wr_data_q.empty())
+    {
+        memWrite(n.wr_addr_q.front(), n.wr_data_q.front().data, n.wr_data_q.front().param);
+        n.wr_addr_q.pop_front();
+        n.wr_data_q.pop_front();
+        n.wr_count++;
+    }
+}
+
+// -------------------------------------------------------------------------
+// getBurstWrData()
+//
+// Append size bytes of the node's burst write data to a FIFO
+//
+// -------------------------------------------------------------------------
+
+void OsvvmNullSim::getBurstWrData (const int node, const int size, std::deque<uint8_t> &fifo)
+{
+    for (int idx = 0; idx < size; idx += 8)
+    {
+        int      lo, hi;
+
+        VGetBurstWrWord(node, idx, &lo, &hi);
+
+        uint64_t word = ((uint64_t)(uint32_t)hi << 32) | (uint32_t)lo;
+
+        for (int bidx = 0; bidx < 8 && idx + bidx < size; bidx++)
+        {
+            fifo.push_back((uint8_t)(word >> (bidx*8)));
+        }
+    }
+}
+
+// -------------------------------------------------------------------------
+// setBurstRdData()
+//
+// Pop size bytes from a FIFO to the node's burst read data
+//
+// -------------------------------------------------------------------------
+
+void OsvvmNullSim::setBurstRdData (const int node, const int size, std::deque<uint8_t> &fifo)
+{
+    if ((int)fifo.size() < size)
+    {
+        alert(node, "burst pop of %d bytes with %d bytes in the burst FIFO", size, (int)fifo.size());
+        return;
+    }
+
+    for (int idx = 0; idx < size; idx += 8)
+    {
+        uint64_t word = 0;
+
+        for (int bidx = 0; bidx < 8 && idx + bidx < size; bidx++)
+        {
+            word |= (uint64_t)fifo.front() << (bidx*8);
+            fifo.pop_front();
+        }
+
+        VSetBurstRdWord(node, idx, (int)(word & 0xffffffffULL), (int)(word >> 32));
+    }
+}
+
+// -------------------------------------------------------------------------
+// pushBurstPattern()
+//
+// Push size bytes of an incrementing or random burst pattern to a FIFO,
+// starting with the first byte of the node's burst write data. The
+// random sequence is not that of the OSVVM models, but is repeatable for
+// checking data written with the same first byte.
+//
+// -------------------------------------------------------------------------
+
+void OsvvmNullSim::pushBurstPattern (const int node, const int burst_type, const int size, std::deque<uint8_t> &fifo)
+{
+    uint32_t val  = getBurstWrByte(node, 0);
+    bool     incr = burst_type == BURST_INCR || burst_type == BURST_INCR_PUSH || burst_type == BURST_INCR_CHECK;
+    uint32_t lfsr = val | 0x100;
+
+    for (int idx = 0; idx < size; idx++)
+    {
+        fifo.push_back((uint8_t)val);
+
+        if (incr)
+        {
+            val++;
+        }
+        else
+        {
+            lfsr = (lfsr >> 1) ^ (-(lfsr & 1) & 0xd0000001U);
+            val  = lfsr;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------
+// getBurstWrByte()
+//
+// Fetch a single byte of the node's burst write data
+//
+// -------------------------------------------------------------------------
+
+int OsvvmNullSim::getBurstWrByte (const int node, const int idx)
+{
+    int data;
+
+    VGetBurstWrByte(node, idx, &data);
+
+    return data & 0xff;
+}
+
+// -------------------------------------------------------------------------
+// checkBurst()
+//
+// Check size bytes of burst data against those popped from an expected
+// data FIFO, flagging an alert on the first mismatch
+//
+// -------------------------------------------------------------------------
+
+bool OsvvmNullSim::checkBurst (const int node, std::vector<uint8_t> &got, std::deque<uint8_t> &exp, const int size)
+{
+    bool match = (int)got.size() >= size && (int)exp.size() >= size;
+
+    if (!match)
+    {
+        alert(node, "burst check of %d bytes with %d received and %d expected", size, (int)got.size(), (int)exp.size());
+    }
+
+    for (int idx = 0; match && idx < size; idx++)
+    {
+        if (got[idx] != exp[idx])
+        {
+            alert(node, "burst check byte %d got 0x%02x, expected 0x%02x", idx, got[idx], exp[idx]);
+            match = false;
+        }
+    }
+
+    exp.erase(exp.begin(), exp.begin() + std::min(size, (int)exp.size()));
+
+    return match;
+}
+
+// -------------------------------------------------------------------------
+// memPage()
+//
+// Return the page of the sparse memory model holding an address,
+// allocating it, zero filled, on first access
+//
+// -------------------------------------------------------------------------
+
+uint8_t* OsvvmNullSim::memPage (const uint64_t addr)
+{
+    std::vector<uint8_t> &page = mem[addr >> NULLSIM_PAGE_BITS];
+
+    if (page.empty())
+    {
+        page.resize(NULLSIM_PAGE_SIZE, 0);
+    }
+
+    return page.data();
+}
+
+// -------------------------------------------------------------------------
+// memRead()
+//
+// Little endian read of bytes from memory
+//
+// -------------------------------------------------------------------------
+
+uint64_t OsvvmNullSim::memRead (const uint64_t addr, const int bytes)
+{
+    uint64_t data = 0;
+
+    for (int idx = 0; idx < bytes; idx++)
+    {
+        data |= (uint64_t)memPage(addr + idx)[(addr + idx) & (NULLSIM_PAGE_SIZE-1)] << (idx*8);
+    }
+
+    return data;
+}
+
+// -------------------------------------------------------------------------
+// memWrite()
+//
+// Little endian write of bytes to memory
+//
+// -------------------------------------------------------------------------
+
+void OsvvmNullSim::memWrite (const uint64_t addr, const uint64_t data, const int bytes)
+{
+    for (int idx = 0; idx < bytes; idx++)
+    {
+        memPage(addr + idx)[(addr + idx) & (NULLSIM_PAGE_SIZE-1)] = (uint8_t)(data >> (idx*8));
+    }
+}
+
+// -------------------------------------------------------------------------
+// alert()
+//
+// Report an error against a node, as the VHDL would with Alert()
+//
+// -------------------------------------------------------------------------
+
+void OsvvmNullSim::alert (const int node, const char* fmt, ...)
+{
+    va_list args;
+
+    va_start(args, fmt);
+    fprintf(stderr, "nullsim: %10llu ***Alert node %d: ", (unsigned long long)cycle, node);
+    vfprintf(stderr, fmt, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+
+    nodes[node].alerts++;
+}
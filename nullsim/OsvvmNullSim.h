@@ -0,0 +1,212 @@
+// =========================================================================
+//
+//  File Name:         OsvvmNullSim.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Defines the OsvvmNullSim class, a software only stand-in for an
+//      HDL simulator, calling the co-simulation VInit and VTrans
+//      procedures directly with simple bus models in place of the
+//      OSVVM verification components.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Scripted read responses
+//    10/2026   ????.??    Read data returned in issue order
+//    10/2026   ????.??    Scripted interrupts optionally raised with VIrqVec
+//    10/2026   ????.??    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_NULL_SIM_H_
+#define _OSVVM_NULL_SIM_H_
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <unordered_map>
+
+#include "OsvvmVProc.h"
+#include "OsvvmVSchedPli.h"
+
+// -------------------------------------------------------------------------
+// DEFINES AND MACROS
+// -------------------------------------------------------------------------
+
+#define NULLSIM_PAGE_BITS          12
+#define NULLSIM_PAGE_SIZE          (1 << NULLSIM_PAGE_BITS)
+
+#define NULLSIM_DEFAULT_MAX_CYCLES 100000000ULL
+#define NULLSIM_DEFAULT_LATENCY    1
+
+// Stream operations common with the address bus, but not defined in
+// stream_operation_t
+#define NULLSIM_STR_WAIT_FOR_TRANSACTION  2
+#define NULLSIM_STR_SET_BURST_MODE        5
+#define NULLSIM_STR_GET_BURST_MODE        6
+#define NULLSIM_STR_SET_MODEL_OPTIONS     8
+#define NULLSIM_STR_GET_MODEL_OPTIONS     9
+
+// -------------------------------------------------------------------------
+// CLASS DEFINITION
+// -------------------------------------------------------------------------
+
+class OsvvmNullSim
+{
+public:
+
+    // A scripted interrupt, setting a node's interrupt vector from a given cycle,
+    // or raising it with VIrqVec
+    typedef struct
+    {
+        uint64_t                          cycle;
+        int                               node;
+        int                               vec;
+        bool                              virq;
+    } irq_event_t;
+
+    // A stream data word, or burst, in flight from a node's transmitter to its receiver
+    typedef struct
+    {
+        uint64_t                          data;
+        int                               param;
+    } stream_word_t;
+
+    typedef struct
+    {
+        std::vector<uint8_t>              data;
+        int                               param;
+    } stream_burst_t;
+
+    // Read data of an address bus read, and the cycle its address was issued
+    typedef struct
+    {
+        uint64_t                          data;
+        uint64_t                          cycle;
+    } rd_data_t;
+
+    // State of a node's bus model
+    typedef struct
+    {
+        bool                              stream;
+        bool                              done;
+        bool                              error;
+        uint64_t                          busy_until;
+        uint64_t                          vtrans_calls;
+        int                               alerts;
+        int                               irq;
+
+        // Inputs to the next VTrans call
+        uint64_t                          rd_data;
+        int                               status;
+        int                               count;
+        int                               countsec;
+        bool                              available;
+
+        // Address bus manager model, with queues for independent write
+        // address and data phases, and read data returned in issue order
+        std::deque<uint64_t>              wr_addr_q;
+        std::deque<stream_word_t>         wr_data_q;      // Data and width in bytes
+        std::deque<rd_data_t>             rd_data_q;
+        std::unordered_map<uint64_t, std::deque<uint64_t> > rd_script;
+        std::deque<uint8_t>               wr_fifo;
+        std::deque<uint8_t>               rd_fifo;
+        uint32_t                          trans_count;
+        uint32_t                          wr_count;
+        uint32_t                          rd_count;
+
+        // Stream loopback model
+        std::deque<stream_word_t>         wire_words;
+        std::deque<stream_burst_t>        wire_bursts;
+        std::deque<uint8_t>               tx_fifo;
+        std::deque<uint8_t>               rx_fifo;
+        uint32_t                          tx_count;
+        uint32_t                          rx_count;
+
+        int                               burst_mode;
+        std::map<int, int>                options;
+    } node_t;
+
+                OsvvmNullSim      (const int num_nodes, const uint64_t max_cycles = NULLSIM_DEFAULT_MAX_CYCLES,
+                                   const int latency = NULLSIM_DEFAULT_LATENCY, const bool verbose = false);
+
+    void        setStreamNode     (const int node)  {nodes[node].stream = true;}
+    int         loadIrqScript     (const char* filename);
+    int         loadReadScript    (const char* filename);
+    int         run               (void);
+
+    uint64_t    getCycles         (void)            {return cycle;}
+    uint64_t    getVTransCalls    (void);
+    std::string getTestName       (void)            {return test_name;}
+
+private:
+
+    void        callVTrans        (const int node);
+
+    uint64_t    busDispatch       (const int node, const int op,   const uint64_t addr, const int addr_width,
+                                   const uint64_t data, const int data_width,
+                                   const int burst_size, const int ticks, const int param);
+    uint64_t    streamDispatch    (const int node, const int op,   const uint64_t data, const int data_width,
+                                   const int burst_size, const int ticks, const int param);
+    void        cosimDispatch     (const int node, const int op,   const int burst_size);
+    uint64_t    drainQueue        (const int node);
+    uint64_t    readPoll          (const int node, const uint64_t addr, const int addr_width,
+                                   const uint64_t expval, const int data_width, const int interval);
+    void        pairWritePhases   (const int node);
+    uint64_t    busRead           (const int node, const uint64_t addr, const int bytes);
+    bool        irqDue            (const int node, const uint64_t until);
+
+    void        getBurstWrData    (const int node, const int size, std::deque<uint8_t> &fifo);
+    void        setBurstRdData    (const int node, const int size, std::deque<uint8_t> &fifo);
+    void        pushBurstPattern  (const int node, const int burst_type, const int size, std::deque<uint8_t> &fifo);
+    int         getBurstWrByte    (const int node, const int idx);
+    bool        checkBurst        (const int node, std::vector<uint8_t> &got, std::deque<uint8_t> &exp, const int size);
+
+    uint8_t*    memPage           (const uint64_t addr);
+    uint64_t    memRead           (const uint64_t addr, const int bytes);
+    void        memWrite          (const uint64_t addr, const uint64_t data, const int bytes);
+
+    void        alert             (const int node, const char* fmt, ...);
+
+    std::vector<node_t>                       nodes;
+    std::vector<irq_event_t>                  irq_events;
+    size_t                                    irq_idx;
+    std::unordered_map<uint64_t, std::vector<uint8_t> > mem;
+
+    uint64_t                                  cycle;
+    uint64_t                                  max_cycles;
+    int                                       latency;
+    bool                                      verbose;
+    std::string                               test_name;
+};
+
+#endif
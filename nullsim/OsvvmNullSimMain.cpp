@@ -0,0 +1,179 @@
+// =========================================================================
+//
+//  File Name:         OsvvmNullSimMain.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Top level of the null simulator, running the co-simulation user
+//      code in VUser.so, via VProc.so, without an HDL simulator.
+//
+//      Usage: VNullSim [-h] [-v] [-n <nodes>] [-s <node>] [-c <cycles>]
+//                      [-l <latency>] [-i <irq script>] [-r <read script>] [-j]
+//
+//        -n  Number of nodes, from node 0 (default 1)
+//        -s  Node is a stream interface, rather than an address bus
+//            manager. May be repeated for multiple nodes.
+//        -c  Maximum number of virtual clock cycles (default 100000000)
+//        -l  Cycles taken by each transaction (default 1)
+//        -i  File of interrupts, one per line as <cycle> <node> <vector>,
+//            raised with VIrqVec when followed by irq
+//        -r  File of read responses, one per line as <node> <addr> <data>,
+//            returned in turn by the node's reads of the address
+//        -v  Print each transaction
+//        -j  Also print the run summary as a JSON benchmark result
+//
+//      Exits with a status of 0 if all the nodes finished without error.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Read response script option
+//    10/2026   ????.??    Interrupt script irq option in usage
+//    10/2026   ????.??    Flush buffered log before exiting
+//    10/2026   ????.??    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+#include <chrono>
+
+#include "OsvvmNullSim.h"
+#include "OsvvmVLog.h"
+
+// -------------------------------------------------------------------------
+// usage()
+// -------------------------------------------------------------------------
+
+static void usage (const char* progname)
+{
+    fprintf(stderr, "Usage: %s [-h] [-v] [-j] [-n <nodes>] [-s <node>] [-c <cycles>] [-l <latency>] [-i <irq script>] [-r <read script>]\n"
+                    "    -n  Number of nodes (default 1)\n"
+                    "    -s  Node is a stream interface (may be repeated)\n"
+                    "    -c  Maximum number of clock cycles (default %llu)\n"
+                    "    -l  Cycles taken by each transaction (default %d)\n"
+                    "    -i  Interrupt script file of <cycle> <node> <vector> [irq] lines\n"
+                    "    -r  Read response script file of <node> <addr> <data> lines\n"
+                    "    -v  Print each transaction\n"
+                    "    -j  Print the run summary as a JSON benchmark result\n",
+                    progname, NULLSIM_DEFAULT_MAX_CYCLES, NULLSIM_DEFAULT_LATENCY);
+}
+
+// -------------------------------------------------------------------------
+// main()
+// -------------------------------------------------------------------------
+
+int main (int argc, char** argv)
+{
+    int                num_nodes    = 1;
+    uint64_t           max_cycles   = NULLSIM_DEFAULT_MAX_CYCLES;
+    int                latency      = NULLSIM_DEFAULT_LATENCY;
+    bool               verbose      = false;
+    bool               json         = false;
+    const char*        irq_script   = NULL;
+    const char*        rd_script    = NULL;
+    std::vector<int>   stream_nodes;
+    int                c;
+
+    while ((c = getopt(argc, argv, "hvjn:s:c:l:i:r:")) != -1)
+    {
+        switch (c)
+        {
+        case 'n': num_nodes  = atoi(optarg);                  break;
+        case 's': stream_nodes.push_back(atoi(optarg));       break;
+        case 'c': max_cycles = strtoull(optarg, NULL, 0);     break;
+        case 'l': latency    = atoi(optarg);                  break;
+        case 'i': irq_script = optarg;                        break;
+        case 'r': rd_script  = optarg;                        break;
+        case 'v': verbose    = true;                          break;
+        case 'j': json       = true;                          break;
+        case 'h': usage(argv[0]);                             return 0;
+        default:  usage(argv[0]);                             return 2;
+        }
+    }
+
+    if (num_nodes < 1 || num_nodes > VP_MAX_NODES || latency < 0)
+    {
+        fprintf(stderr, "***Error: nullsim number of nodes must be 1 to %d, and latency not negative\n", VP_MAX_NODES);
+        return 2;
+    }
+
+    OsvvmNullSim sim(num_nodes, max_cycles, latency, verbose);
+
+    for (int node : stream_nodes)
+    {
+        if (node < 0 || node >= num_nodes)
+        {
+            fprintf(stderr, "***Error: nullsim stream node %d out of range\n", node);
+            return 2;
+        }
+
+        sim.setStreamNode(node);
+    }
+
+    if (irq_script && sim.loadIrqScript(irq_script) == -1)
+    {
+        return 2;
+    }
+
+    if (rd_script && sim.loadReadScript(rd_script) == -1)
+    {
+        return 2;
+    }
+
+    auto start  = std::chrono::steady_clock::now();
+
+    int  status = sim.run();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    // Write out any buffered VPrint messages, as exiting without atexit handlers
+    VLogFlush();
+
+    printf("nullsim: %s %s (%llu cycles, %llu VTrans calls, %.3f s)\n",
+           sim.getTestName().c_str(), status ? "FAILED" : "PASSED",
+           (unsigned long long)sim.getCycles(), (unsigned long long)sim.getVTransCalls(), elapsed.count());
+
+    if (json)
+    {
+        printf("bench: {\"bench\": \"nullsim\", \"test\": \"%s\", \"nodes\": %d, \"cycles\": %llu, "
+               "\"vtrans_calls\": %llu, \"seconds\": %.6f, \"ns_per_vtrans\": %.1f, \"passed\": %s}\n",
+               sim.getTestName().c_str(), num_nodes, (unsigned long long)sim.getCycles(),
+               (unsigned long long)sim.getVTransCalls(), elapsed.count(),
+               sim.getVTransCalls() ? elapsed.count() * 1e9 / sim.getVTransCalls() : 0.0,
+               status ? "false" : "true");
+    }
+
+    fflush(stdout);
+
+    // User threads are still waiting on the simulator, so don't wait on them
+    _exit(status);
+}
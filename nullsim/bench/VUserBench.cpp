@@ -0,0 +1,287 @@
+// ------------------------------------------------------------------------------
+//
+//  File Name:           VUserBench.cpp
+//  Design Unit Name:    Co-simulation benchmark program
+//  Revision:            OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:          Simon Southwell      email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell   simon.southwell@gmail.com
+//
+//  Description:
+//      Co-simulation micro-benchmarks, run on the null simulator with the
+//      makefile.nullsim bench target. The benchmark is selected with the
+//      OSVVM_BENCH environment variable:
+//
+//        trans  : transWrite/transRead round trip latency, transBurstWrite/
+//                 transBurstRead throughput for 16 to 4096 byte bursts and
+//                 VTick cost (node 0 an address bus manager)
+//        stream : streamBurstSend/streamBurstGet throughput for 16 to 4096
+//                 byte bursts (node 0 a stream interface)
+//        scale  : transWrite/transRead from every node, timed by the null
+//                 simulator for 1 to 64 nodes
+//
+//      OSVVM_BENCH_ITERATIONS sets the number of iterations of each
+//      measurement (default 10000). Results are printed as one JSON
+//      object per line, prefixed with "bench: ".
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Initial revision
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// ------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <chrono>
+
+// Import OSVVM user API for address bus and streams
+#include "OsvvmCosim.h"
+#include "OsvvmCosimStreamTx.h"
+#include "OsvvmCosimStreamRx.h"
+
+#define BENCH_DEFAULT_ITERATIONS 10000
+#define BENCH_MIN_BURST          16
+#define BENCH_MAX_BURST          4096
+
+typedef std::chrono::steady_clock bench_clock_t;
+
+// ------------------------------------------------------------------------------
+// Number of iterations of each measurement
+// ------------------------------------------------------------------------------
+
+static int benchIterations (void)
+{
+    const char* iter_str = getenv("OSVVM_BENCH_ITERATIONS");
+    int         iter     = iter_str ? atoi(iter_str) : BENCH_DEFAULT_ITERATIONS;
+
+    return iter > 0 ? iter : BENCH_DEFAULT_ITERATIONS;
+}
+
+// ------------------------------------------------------------------------------
+// Nanoseconds elapsed since start, divided by the number of operations
+// ------------------------------------------------------------------------------
+
+static double nsPerOp (const bench_clock_t::time_point start, const int ops)
+{
+    std::chrono::duration<double, std::nano> elapsed = bench_clock_t::now() - start;
+
+    return elapsed.count() / ops;
+}
+
+// ------------------------------------------------------------------------------
+// Print a latency result, and a throughput result for a burst size in bytes
+// ------------------------------------------------------------------------------
+
+static void benchLatency (const char* name, const int iter, const double ns)
+{
+    printf("bench: {\"bench\": \"%s\", \"iterations\": %d, \"ns_per_op\": %.1f}\n", name, iter, ns);
+}
+
+static void benchThroughput (const char* name, const int bytes, const int iter, const double ns)
+{
+    printf("bench: {\"bench\": \"%s\", \"bytes\": %d, \"iterations\": %d, \"ns_per_op\": %.1f, \"mbytes_per_sec\": %.1f}\n",
+           name, bytes, iter, ns, bytes * 1e3 / ns);
+}
+
+// ------------------------------------------------------------------------------
+// Address bus benchmarks
+// ------------------------------------------------------------------------------
+
+static bool benchTrans (const int node, const int iter)
+{
+    OsvvmCosim             cosim(node, "CoSim_bench_trans");
+    uint8_t                wbuf[BENCH_MAX_BURST], rbuf[BENCH_MAX_BURST];
+    uint32_t               rdata;
+    bench_clock_t::time_point start;
+
+    start = bench_clock_t::now();
+    for (int idx = 0; idx < iter; idx++)
+    {
+        cosim.transWrite((uint32_t)(idx << 2), (uint32_t)idx);
+    }
+    benchLatency("trans_write", iter, nsPerOp(start, iter));
+
+    start = bench_clock_t::now();
+    for (int idx = 0; idx < iter; idx++)
+    {
+        cosim.transRead((uint32_t)(idx << 2), &rdata);
+    }
+    benchLatency("trans_read", iter, nsPerOp(start, iter));
+
+    for (int idx = 0; idx < BENCH_MAX_BURST; idx++)
+    {
+        wbuf[idx] = idx;
+    }
+
+    for (int bytes = BENCH_MIN_BURST; bytes <= BENCH_MAX_BURST; bytes <<= 1)
+    {
+        start = bench_clock_t::now();
+        for (int idx = 0; idx < iter; idx++)
+        {
+            cosim.transBurstWrite((uint32_t)0x10000000, wbuf, bytes);
+        }
+        benchThroughput("trans_burst_write", bytes, iter, nsPerOp(start, iter));
+
+        start = bench_clock_t::now();
+        for (int idx = 0; idx < iter; idx++)
+        {
+            cosim.transBurstRead((uint32_t)0x10000000, rbuf, bytes);
+        }
+        benchThroughput("trans_burst_read", bytes, iter, nsPerOp(start, iter));
+
+        if (memcmp(wbuf, rbuf, bytes))
+        {
+            VPrint("VUserBench: ***ERROR*** burst read data mismatch for %d bytes\n", bytes);
+            return true;
+        }
+    }
+
+    // Single ticks, and multi-cycle ticks counted down by the simulator
+    start = bench_clock_t::now();
+    for (int idx = 0; idx < iter; idx++)
+    {
+        cosim.tick(1);
+    }
+    benchLatency("tick_1", iter, nsPerOp(start, iter));
+
+    start = bench_clock_t::now();
+    for (int idx = 0; idx < iter; idx++)
+    {
+        cosim.tick(100);
+    }
+    benchLatency("tick_100_per_tick", iter * 100, nsPerOp(start, iter * 100));
+
+    return false;
+}
+
+// ------------------------------------------------------------------------------
+// Stream benchmarks, with the null simulator looping transmit to receive
+// ------------------------------------------------------------------------------
+
+static bool benchStream (const int node, const int iter)
+{
+    OsvvmCosimStreamTx     tx(node, "CoSim_bench_stream");
+    OsvvmCosimStreamRx     rx(node);
+    uint8_t                wbuf[BENCH_MAX_BURST], rbuf[BENCH_MAX_BURST];
+    bench_clock_t::time_point start;
+
+    for (int idx = 0; idx < BENCH_MAX_BURST; idx++)
+    {
+        wbuf[idx] = idx;
+    }
+
+    for (int bytes = BENCH_MIN_BURST; bytes <= BENCH_MAX_BURST; bytes <<= 1)
+    {
+        start = bench_clock_t::now();
+        for (int idx = 0; idx < iter; idx++)
+        {
+            tx.streamBurstSend(wbuf, bytes);
+            rx.streamBurstGet(rbuf, bytes);
+        }
+        benchThroughput("stream_burst_send_get", bytes, iter, nsPerOp(start, iter));
+
+        if (memcmp(wbuf, rbuf, bytes))
+        {
+            VPrint("VUserBench: ***ERROR*** stream burst data mismatch for %d bytes\n", bytes);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// ------------------------------------------------------------------------------
+// Scaling workload, run on every node, with the total time measured by the
+// null simulator
+// ------------------------------------------------------------------------------
+
+static void benchScale (const int node)
+{
+    OsvvmCosim cosim(node, node == 0 ? "CoSim_bench_scale" : "");
+    int        iter  = benchIterations();
+    uint32_t   base  = node << 20;
+    uint32_t   rdata;
+    bool       error = false;
+
+    for (int idx = 0; idx < iter && !error; idx++)
+    {
+        cosim.transWrite(base + (idx << 2), (uint32_t)idx);
+        cosim.transRead(base + (idx << 2), &rdata);
+
+        if (rdata != (uint32_t)idx)
+        {
+            VPrint("VUserBench: ***ERROR*** node %d read %08x, expected %08x\n", node, rdata, idx);
+            error = true;
+        }
+    }
+
+    cosim.tick(1, true, error);
+
+    SLEEPFOREVER;
+}
+
+// ------------------------------------------------------------------------------
+// Main entry point for node 0, running the selected benchmark
+// ------------------------------------------------------------------------------
+
+extern "C" void VUserMain0()
+{
+    const int   node  = 0;
+    const char* bench = getenv("OSVVM_BENCH");
+    int         iter  = benchIterations();
+    bool        error;
+
+    if (bench && !strcmp(bench, "scale"))
+    {
+        benchScale(node);
+    }
+
+    if (bench && !strcmp(bench, "stream"))
+    {
+        error = benchStream(node, iter);
+    }
+    else
+    {
+        error = benchTrans(node, iter);
+    }
+
+    fflush(stdout);
+
+    VTick(1, true, error, node);
+
+    SLEEPFOREVER;
+}
+
+// ------------------------------------------------------------------------------
+// Entry points for the other nodes, only used by the scale benchmark
+// ------------------------------------------------------------------------------
+
+#define BENCH_NODE(_n) extern "C" void VUserMain##_n() {benchScale(_n);}
+
+BENCH_NODE(1)  BENCH_NODE(2)  BENCH_NODE(3)  BENCH_NODE(4)  BENCH_NODE(5)  BENCH_NODE(6)  BENCH_NODE(7)
+BENCH_NODE(8)  BENCH_NODE(9)  BENCH_NODE(10) BENCH_NODE(11) BENCH_NODE(12) BENCH_NODE(13) BENCH_NODE(14) BENCH_NODE(15)
+BENCH_NODE(16) BENCH_NODE(17) BENCH_NODE(18) BENCH_NODE(19) BENCH_NODE(20) BENCH_NODE(21) BENCH_NODE(22) BENCH_NODE(23)
+BENCH_NODE(24) BENCH_NODE(25) BENCH_NODE(26) BENCH_NODE(27) BENCH_NODE(28) BENCH_NODE(29) BENCH_NODE(30) BENCH_NODE(31)
+BENCH_NODE(32) BENCH_NODE(33) BENCH_NODE(34) BENCH_NODE(35) BENCH_NODE(36) BENCH_NODE(37) BENCH_NODE(38) BENCH_NODE(39)
+BENCH_NODE(40) BENCH_NODE(41) BENCH_NODE(42) BENCH_NODE(43) BENCH_NODE(44) BENCH_NODE(45) BENCH_NODE(46) BENCH_NODE(47)
+BENCH_NODE(48) BENCH_NODE(49) BENCH_NODE(50) BENCH_NODE(51) BENCH_NODE(52) BENCH_NODE(53) BENCH_NODE(54) BENCH_NODE(55)
+BENCH_NODE(56) BENCH_NODE(57) BENCH_NODE(58) BENCH_NODE(59) BENCH_NODE(60) BENCH_NODE(61) BENCH_NODE(62) BENCH_NODE(63)
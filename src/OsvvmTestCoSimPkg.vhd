@@ -14,6 +14,16 @@
 --
 --  Revision History:
 --    Date      Version    Description
+--    10/2026   ????.??    Non-transaction operations wait for VPTicks clocks, if non-zero
+--    10/2026   ????.??    Burst FIFO read data mapped with MetaTo01 before conversion
+--    10/2026   ????.??    Added POOL_COLLECT, calling VTrans again after a delta
+--                         cycle to collect a node dispatched to a pool worker
+--    10/2026   ????.??    Added READ_POLL, executing read polling loops in CoSimReadPoll,
+--                         ended early by interrupts if requested, from CoSimIrq
+--                         or changes of gIntReq
+--    10/2026   ????.??    Added QUEUE_DRAIN of transaction submission queues
+--    10/2026   ????.??    Burst data transferred between co-sim buffers and
+--                         FIFOs a 64-bit word at a time
 --    09/2025   ????.??    Updated CoSimIrq to use VIrqVec
 --                         Added support for Set- & Get- burst mode and model options
 --    05/2023   2023.05    Adding asynchronous, check and try transaction support,
@@ -50,6 +60,7 @@ library OSVVM ;
 
 library OSVVM_Common ;
   use OSVVM_Common.AddressBusTransactionPkg.all ;
+  use OSVVM_Common.InterruptGlobalSignalPkg.all ;
 
 library osvvm_ethernet ;
     context osvvm_ethernet.xMiiContext ;
@@ -60,7 +71,8 @@ library osvvm_cosim ;
 package OsvvmTestCoSimPkg is
 
   -- CoSim specific enumerations
-  type CoSimOperationType is (SET_TEST_NAME) ;                            -- For non-standard VPOperation values on VPOp from VTrans
+  type CoSimOperationType is (SET_TEST_NAME, QUEUE_DRAIN, READ_POLL,             -- For non-standard VPOperation values on VPOp from VTrans
+                              POOL_COLLECT) ;
 
   type BurstType          is (BURST_NORM,       BURST_INCR,               -- Burst sub-operation selection in VPParam from VTrans
                               BURST_RAND,       BURST_INCR_PUSH,
@@ -71,6 +83,10 @@ package OsvvmTestCoSimPkg is
 
   type DirType            is (RX_REC, TX_REC);                            -- Stream bus direction in (overloaded) VPData from VTrans
 
+  -- Select transfer of burst data to and from the co-sim buffers a 64-bit word per foreign
+  -- procedure call (VGetBurstWrWord/VSetBurstRdWord), or a byte per call (VGetBurstWrByte/VSetBurstRdByte)
+  constant COSIM_BURST_WORD_XFER : boolean := TRUE ;
+
   ------------------------------------------------------------
   -- function to construct slv_vector from CoSim burst data
   ------------------------------------------------------------
@@ -80,6 +96,28 @@ package OsvvmTestCoSimPkg is
     constant NodeNum         : in     integer
   ) return slv_vector ;
 
+  ------------------------------------------------------------
+  -- Procedure to push VPBurstSize bytes of CoSim burst data
+  -- to a burst FIFO
+  ------------------------------------------------------------
+
+  procedure CoSimPushBurstData (
+    constant Fifo            : in     ScoreboardIdType ;
+    constant VPBurstSize     : in     integer ;
+    constant NodeNum         : in     integer
+  ) ;
+
+  ------------------------------------------------------------
+  -- Procedure to pop VPBurstSize bytes from a burst FIFO
+  -- to the CoSim burst data buffer
+  ------------------------------------------------------------
+
+  procedure CoSimPopBurstData (
+    constant Fifo            : in     ScoreboardIdType ;
+    constant VPBurstSize     : in     integer ;
+    constant NodeNum         : in     integer
+  ) ;
+
   ------------------------------------------------------------
   -- Co-simulation procedure to initialise and start user code
   -- for a given node.
@@ -154,6 +192,33 @@ procedure CoSimResp (
     constant NodeNum         : in     integer
   ) ;
 
+  ------------------------------------------------------------
+  -- Co-simulation procedure to execute the transactions in
+  -- a node's submission queue, returning completions
+  ------------------------------------------------------------
+
+  procedure CoSimDrainQueue (
+    signal   ManagerRec      : inout  AddressBusRecType ;
+    constant NodeNum         : in     integer
+  ) ;
+
+  ------------------------------------------------------------
+  -- Co-simulation procedure to repeatedly read an address
+  -- until the masked read data matches an expected value
+  ------------------------------------------------------------
+
+  procedure CoSimReadPoll (
+    signal   ManagerRec      : inout  AddressBusRecType ;
+    constant VPAddr          : in     integer ;
+    constant VPAddrHi        : in     integer ;
+    constant VPAddrWidth     : in     integer ;
+    constant VPDataOut       : in     integer ;
+    constant VPDataOutHi     : in     integer ;
+    constant VPDataWidth     : in     integer ;
+    constant VPParam         : in     integer ;
+    constant NodeNum         : in     integer
+  ) ;
+
   ------------------------------------------------------------
   -- Co-simulation procedure to dispatch one address bus
   -- transaction repsonse
@@ -206,29 +271,143 @@ end package OsvvmTestCoSimPkg ;
 package body OsvvmTestCoSimPkg is
   constant ADDR_WIDTH_MAX    : integer := 64 ;
   constant DATA_WIDTH_MAX    : integer := 64 ;
+  constant POOL_COLLECT_OP   : integer := 1024 + CoSimOperationType'pos(POOL_COLLECT) ;
 
 
   impure function GetCoSimBurstVector(
     constant VPBurstSize     : in     integer ;
     constant NodeNum         : in     integer
   ) return slv_vector is
-    variable result     : slv_vector(0 to VPBurstSize-1)(7 downto 0) ;
-    variable WrDataInt  : integer ;
-    variable WrByteData : signed (DATA_WIDTH_MAX-1 downto 0) ;
+    variable result      : slv_vector(0 to VPBurstSize-1)(7 downto 0) ;
+    variable WrDataInt   : integer ;
+    variable WrDataHiInt : integer ;
+    variable WrByteData  : signed (DATA_WIDTH_MAX-1 downto 0) ;
+    variable bidx        : integer := 0 ;
   begin
-    for bidx in 0 to VPBurstSize-1 loop
+    if COSIM_BURST_WORD_XFER then
 
-      -- Get Byte from co-sim interface
-      VGetBurstWrByte(NodeNum, bidx, WrDataInt) ;
-      WrByteData   := to_signed(WrDataInt, WrByteData'length) ;
-      result(bidx) := std_logic_vector(WrByteData(7 downto 0)) ;
+      while bidx < VPBurstSize loop
 
-    end loop ;
+        -- Get a 64-bit word from co-sim interface and unpack the valid bytes
+        VGetBurstWrWord(NodeNum, bidx, WrDataInt, WrDataHiInt) ;
+        WrByteData(31 downto  0) := to_signed(WrDataInt,   32) ;
+        WrByteData(63 downto 32) := to_signed(WrDataHiInt, 32) ;
+
+        for widx in 0 to minimum(8, VPBurstSize - bidx) - 1 loop
+          result(bidx + widx) := std_logic_vector(WrByteData(widx*8 + 7 downto widx*8)) ;
+        end loop ;
+
+        bidx := bidx + 8 ;
+      end loop ;
+
+    else
+
+      for idx in 0 to VPBurstSize-1 loop
+
+        -- Get Byte from co-sim interface
+        VGetBurstWrByte(NodeNum, idx, WrDataInt) ;
+        WrByteData  := to_signed(WrDataInt, WrByteData'length) ;
+        result(idx) := std_logic_vector(WrByteData(7 downto 0)) ;
+
+      end loop ;
+
+    end if ;
 
     return result ;
 
   end function GetCoSimBurstVector ;
 
+  ------------------------------------------------------------
+  -- Procedure to push VPBurstSize bytes of CoSim burst data
+  -- to a burst FIFO
+  ------------------------------------------------------------
+
+  procedure CoSimPushBurstData (
+    constant Fifo            : in     ScoreboardIdType ;
+    constant VPBurstSize     : in     integer ;
+    constant NodeNum         : in     integer
+  ) is
+    variable WrDataInt       : integer ;
+    variable WrDataHiInt     : integer ;
+    variable WrByteData      : signed (DATA_WIDTH_MAX-1 downto 0) ;
+    variable bidx            : integer := 0 ;
+  begin
+    if COSIM_BURST_WORD_XFER then
+
+      while bidx < VPBurstSize loop
+
+        -- Fetch a 64-bit word from the co-sim send buffer and push the valid bytes to the fifo
+        VGetBurstWrWord(NodeNum, bidx, WrDataInt, WrDataHiInt) ;
+        WrByteData(31 downto  0) := to_signed(WrDataInt,   32) ;
+        WrByteData(63 downto 32) := to_signed(WrDataHiInt, 32) ;
+
+        for widx in 0 to minimum(8, VPBurstSize - bidx) - 1 loop
+          Push(Fifo, std_logic_vector(WrByteData(widx*8 + 7 downto widx*8))) ;
+        end loop ;
+
+        bidx := bidx + 8 ;
+      end loop ;
+
+    else
+
+      for idx in 0 to VPBurstSize-1 loop
+        VGetBurstWrByte(NodeNum, idx, WrDataInt) ;
+        WrByteData := to_signed(WrDataInt, WrByteData'length) ;
+        Push(Fifo, std_logic_vector(WrByteData(7 downto 0))) ;
+      end loop ;
+
+    end if ;
+  end procedure CoSimPushBurstData ;
+
+  ------------------------------------------------------------
+  -- Procedure to pop VPBurstSize bytes from a burst FIFO
+  -- to the CoSim burst data buffer
+  ------------------------------------------------------------
+
+  procedure CoSimPopBurstData (
+    constant Fifo            : in     ScoreboardIdType ;
+    constant VPBurstSize     : in     integer ;
+    constant NodeNum         : in     integer
+  ) is
+    variable RdData          : std_logic_vector (DATA_WIDTH_MAX-1 downto 0) ;
+    variable RdDataInt       : integer ;
+    variable RdDataHiInt     : integer ;
+    variable bidx            : integer := 0 ;
+  begin
+    if COSIM_BURST_WORD_XFER then
+
+      while bidx < VPBurstSize loop
+
+        -- Pop up to eight bytes from the fifo and write them to the co-sim receive buffer as a 64-bit word
+        RdData := (others => '0') ;
+
+        for widx in 0 to minimum(8, VPBurstSize - bidx) - 1 loop
+          Pop(Fifo, RdData(widx*8 + 7 downto widx*8)) ;
+        end loop ;
+
+        -- Map any meta-values per bit, so one unknown byte doesn't zero the whole 32-bit half
+        RdData      := osvvm.TbUtilPkg.MetaTo01(RdData) ;
+
+        RdDataInt   := to_integer(signed(RdData(31 downto  0))) ;
+        RdDataHiInt := to_integer(signed(RdData(63 downto 32))) ;
+        VSetBurstRdWord(NodeNum, bidx, RdDataInt, RdDataHiInt) ;
+
+        bidx := bidx + 8 ;
+      end loop ;
+
+    else
+
+      RdData := (others => '0') ;
+
+      for idx in 0 to VPBurstSize-1 loop
+        Pop(Fifo, RdData(7 downto 0)) ;
+        RdDataInt := to_integer(unsigned(osvvm.TbUtilPkg.MetaTo01(RdData(7 downto 0)))) ;
+        VSetBurstRdByte(NodeNum, idx, RdDataInt) ;
+      end loop ;
+
+    end if ;
+  end procedure CoSimPopBurstData ;
+
   ------------------------------------------------------------
   -- Co-simulation software initialisation procedure for
   -- a specified node. Must be called, once per node, before
@@ -291,12 +470,19 @@ package body OsvvmTestCoSimPkg is
       VPDataHi   := 0 ;
     end if;
 
-    -- Call VTrans to generate a new access
-    VTrans(NodeNum,   IntReq,      VPStatus,  VPCount, UnusedCount,
-           VPData,    VPDataHi,    VPDataWidth,
-           VPAddr,    VPAddrHi,    VPAddrWidth,
-           VPOp,      VPBurstSize, VPTicks,
-           VPDone,    VPError,     VPParam) ;
+    -- Call VTrans to generate a new access. In pool mode, VTrans first returns
+    -- POOL_COLLECT, for it to be called again after a delta cycle, once all the
+    -- nodes due in this delta cycle have been dispatched to the worker threads
+    loop
+      VTrans(NodeNum,   IntReq,      VPStatus,  VPCount, UnusedCount,
+             VPData,    VPDataHi,    VPDataWidth,
+             VPAddr,    VPAddrHi,    VPAddrWidth,
+             VPOp,      VPBurstSize, VPTicks,
+             VPDone,    VPError,     VPParam) ;
+
+      exit when VPOp /= POOL_COLLECT_OP ;
+      wait for 0 ns ;
+    end loop ;
 
     Done  := VPDone  ;
     Error := VPError ;
@@ -440,12 +626,7 @@ package body OsvvmTestCoSimPkg is
               if BurstType'val(VPParam) = BURST_NORM or BurstType'val(VPParam) = BURST_DATA then
 
                 -- Pop the bytes from the read fifo and write them to the co-sim receive buffer
-                RdData := (others => '0');
-                for bidx in 0 to VPBurstSize-1 loop
-                  Pop(ManagerRec.ReadBurstFifo, RdData(7 downto 0)) ;
-                  RdDataInt := to_integer(unsigned(RdData(7 downto 0))) ;
-                  VSetBurstRdByte(NodeNum, bidx, RdDataInt) ;
-                end loop;
+                CoSimPopBurstData(ManagerRec.ReadBurstFifo, VPBurstSize, NodeNum) ;
 
               end if ;
 
@@ -496,11 +677,7 @@ package body OsvvmTestCoSimPkg is
             when BURST_NORM | BURST_DATA =>
 
               -- Fetch the bytes from the co-sim send buffer and push to the transaction write fifo
-              for bidx in 0 to VPBurstSize-1 loop
-                VGetBurstWrByte(NodeNum, bidx, WrDataInt) ;
-                WrByteData := to_signed(WrDataInt, WrByteData'length) ;
-                Push(ManagerRec.WriteBurstFifo, std_logic_vector(WrByteData(7 downto 0))) ;
-              end loop ;
+              CoSimPushBurstData(ManagerRec.WriteBurstFifo, VPBurstSize, NodeNum) ;
 
             when BURST_INCR | BURST_INCR_PUSH =>
 
@@ -587,14 +764,177 @@ package body OsvvmTestCoSimPkg is
 
           SetTestName(TestName(1 to VPBurstSize)) ;
 
+        when QUEUE_DRAIN =>
+          CoSimDrainQueue(ManagerRec, NodeNum) ;
+
+        when READ_POLL =>
+          CoSimReadPoll(ManagerRec,
+                        VPAddr,      VPAddrHi,    VPAddrWidth,
+                        VPDataOut,   VPDataOutHi, VPDataWidth,
+                        VPParam,     NodeNum) ;
+
         when others =>
           Alert("CoSim/src/OsvvmTestCoSimPkg: CoSimDispatchOneTransaction received unimplemented transaction") ;
       end case ;
 
+      -- If VPTicks non-zero (a queue drain polling for read futures) do wait for clock after the operation
+      if VPTicks /= 0 then
+        WaitForClock(ManagerRec, VPTicks) ;
+      end if ;
+
     end if ;
 
   end procedure CoSimDispatchOneTransaction ;
 
+  ------------------------------------------------------------
+  -- Co-simulation procedure to execute the transactions in
+  -- a node's submission queue. Each is dispatched as for
+  -- CoSimTrans, with its read data and status returned as a
+  -- completion. Stops when the queue is empty, or the
+  -- completion queue is full.
+  ------------------------------------------------------------
+  procedure CoSimDrainQueue (
+    signal   ManagerRec      : inout  AddressBusRecType ;
+    constant NodeNum         : in     integer
+  ) is
+
+    variable RdData          : std_logic_vector (ManagerRec.DataFromModel'range) ;
+
+    variable VPOp            : integer ;
+    variable VPAddr          : integer ;
+    variable VPAddrHi        : integer ;
+    variable VPAddrWidth     : integer ;
+    variable VPData          : integer ;
+    variable VPDataHi        : integer ;
+    variable VPDataWidth     : integer ;
+    variable VPValid         : integer ;
+    variable VPStatus        : integer ;
+
+  begin
+
+    loop
+      VGetQueueTrans(NodeNum, VPOp,   VPAddr,   VPAddrHi, VPAddrWidth,
+                              VPData, VPDataHi, VPDataWidth,
+                              VPValid) ;
+
+      exit when VPValid = 0 ;
+
+      CoSimDispatchOneTransaction(ManagerRec,
+                                  VPOp,
+                                  VPAddr,      VPAddrHi,    VPAddrWidth,
+                                  VPData,      VPDataHi,    VPDataWidth,
+                                  0,           0,           0,
+                                  NodeNum) ;
+
+      -- Sample the read data and status of the transaction
+      RdData   := osvvm.TbUtilPkg.MetaTo01(SafeResize(ManagerRec.DataFromModel, RdData'length)) ;
+      VPStatus := 1 when ManagerRec.BoolFromModel else 0 ;
+
+      if RdData'length > 32 then
+        VPData   := to_integer(signed(RdData(31 downto  0))) ;
+        VPDataHi := to_integer(signed(RdData(RdData'length-1 downto 32))) ;
+      else
+        VPData   := to_integer(signed(RdData(RdData'length-1 downto 0))) ;
+        VPDataHi := 0 ;
+      end if;
+
+      VPutQueueResp(NodeNum, VPData, VPDataHi, VPStatus) ;
+    end loop ;
+
+  end procedure CoSimDrainQueue ;
+
+  ------------------------------------------------------------
+  -- Co-simulation procedure to repeatedly read an address,
+  -- waiting VPParam clocks before each read, until the read
+  -- data bits selected by a mask match the expected value in
+  -- VPDataOut/VPDataOutHi, or a maximum number of reads (if
+  -- non-zero) is reached, or, if requested, a VIrqVec
+  -- interrupt is raised or the gIntReq interrupt requests
+  -- change. The mask, maximum number of reads and stop on
+  -- interrupt request are in the burst write data buffer,
+  -- with the C side flagging a raised VIrqVec interrupt
+  -- there. The number of reads, and whether matched or
+  -- interrupted, are returned in the burst read data buffer,
+  -- with the last read data returned as for a read
+  -- transaction.
+  ------------------------------------------------------------
+  procedure CoSimReadPoll (
+    signal   ManagerRec      : inout  AddressBusRecType ;
+    constant VPAddr          : in     integer ;
+    constant VPAddrHi        : in     integer ;
+    constant VPAddrWidth     : in     integer ;
+    constant VPDataOut       : in     integer ;
+    constant VPDataOutHi     : in     integer ;
+    constant VPDataWidth     : in     integer ;
+    constant VPParam         : in     integer ;
+    constant NodeNum         : in     integer
+  ) is
+
+    variable RdData          : std_logic_vector (DATA_WIDTH_MAX-1 downto 0) ;
+    variable ExpData         : std_logic_vector (DATA_WIDTH_MAX-1 downto 0) ;
+    variable Mask            : std_logic_vector (DATA_WIDTH_MAX-1 downto 0) ;
+    variable Address         : std_logic_vector (ADDR_WIDTH_MAX-1 downto 0) ;
+    variable MaskInt         : integer ;
+    variable MaskHiInt       : integer ;
+    variable MaxPolls        : integer ;
+    variable UnusedInt       : integer ;
+    variable IrqStop         : integer ;
+    variable IrqRaised       : integer ;
+    variable Polls           : integer := 0 ;
+    variable Matched         : integer := 0 ;
+    variable Interrupted     : integer := 0 ;
+    variable IntReqStart     : std_logic_vector(gIntReq'range) ;
+
+  begin
+
+    IntReqStart           := gIntReq ;
+
+    Address(31 downto  0) := std_logic_vector(to_signed(VPAddr,      32)) ;
+    Address(63 downto 32) := std_logic_vector(to_signed(VPAddrHi,    32)) ;
+
+    ExpData(31 downto 0 ) := std_logic_vector(to_signed(VPDataOut,   32)) ;
+    ExpData(63 downto 32) := std_logic_vector(to_signed(VPDataOutHi, 32)) ;
+
+    -- Fetch the mask and the maximum number of reads from the burst write data buffer
+    VGetBurstWrWord(NodeNum, 0, MaskInt,  MaskHiInt) ;
+    VGetBurstWrWord(NodeNum, 8, MaxPolls, UnusedInt) ;
+
+    Mask(31 downto 0 )    := std_logic_vector(to_signed(MaskInt,     32)) ;
+    Mask(63 downto 32)    := std_logic_vector(to_signed(MaskHiInt,   32)) ;
+
+    loop
+      if VPParam > 0 then
+        WaitForClock(ManagerRec, VPParam) ;
+      end if ;
+
+      Read (ManagerRec, Address(VPAddrWidth-1 downto 0), RdData(VPDataWidth-1 downto 0)) ;
+
+      Polls := Polls + 1 ;
+
+      if (RdData(VPDataWidth-1 downto 0)  and Mask(VPDataWidth-1 downto 0)) =
+         (ExpData(VPDataWidth-1 downto 0) and Mask(VPDataWidth-1 downto 0)) then
+        Matched := 1 ;
+      end if ;
+
+      exit when Matched = 1 or (MaxPolls > 0 and Polls >= MaxPolls) ;
+
+      -- End the poll on a raised interrupt, or changed interrupt requests, if requested,
+      -- for the interrupt to be processed
+      VGetBurstWrWord(NodeNum, 16, IrqStop, IrqRaised) ;
+
+      if IrqStop /= 0 and (IrqRaised /= 0 or gIntReq /= IntReqStart) then
+        Interrupted := 1 ;
+      end if ;
+
+      exit when Interrupted = 1 ;
+    end loop ;
+
+    -- Return the number of reads, and whether matched or interrupted, in the burst read data buffer
+    VSetBurstRdWord(NodeNum, 0, Polls,       Matched) ;
+    VSetBurstRdWord(NodeNum, 8, Interrupted, 0) ;
+
+  end procedure CoSimReadPoll ;
+
   ------------------------------------------------------------
   -- Co-simulation wrapper procedure to receive transactions
   -- and send responses
@@ -653,12 +993,18 @@ package body OsvvmTestCoSimPkg is
       VPAddrHi   := 0 ;
     end if ;
 
-    -- Call VTrans to generate a new response operation
-    VTrans(NodeNum,      UnusedIntReq,   VPStatus,  VPCount, UnusedCount,
-           VPData,       VPDataHi,       VPDataWidth,
-           VPAddr,       VPAddrHi,       VPAddrWidth,
-           VPOp,         VPBurstSize,    VPTicks,
-           VPDone,       VPError,        VPParam) ;
+    -- Call VTrans to generate a new response operation, collecting a node
+    -- dispatched to a pool worker after a delta cycle, as for CoSimTrans
+    loop
+      VTrans(NodeNum,      UnusedIntReq,   VPStatus,  VPCount, UnusedCount,
+             VPData,       VPDataHi,       VPDataWidth,
+             VPAddr,       VPAddrHi,       VPAddrWidth,
+             VPOp,         VPBurstSize,    VPTicks,
+             VPDone,       VPError,        VPParam) ;
+
+      exit when VPOp /= POOL_COLLECT_OP ;
+      wait for 0 ns ;
+    end loop ;
 
     Done  := VPDone  ;
     Error := VPError ;
@@ -846,12 +1192,18 @@ package body OsvvmTestCoSimPkg is
     end if;
 
 
-    -- Call VTrans to generate a new TX access
-    VTrans(NodeNum,        Available,      VPStatus, VPCountRx, VPCountTx,
-           VPData,         VPDataHi,       VPDataWidth,
-           UnusedVPAddrLo, UnusedVPAddrHi, UnusedVPAddrWidth,
-           VPOp,           VPBurstSize,    VPTicks,
-           VPDone,         VPError,        VPParam) ;
+    -- Call VTrans to generate a new TX access, collecting a node dispatched
+    -- to a pool worker after a delta cycle, as for CoSimTrans
+    loop
+      VTrans(NodeNum,        Available,      VPStatus, VPCountRx, VPCountTx,
+             VPData,         VPDataHi,       VPDataWidth,
+             UnusedVPAddrLo, UnusedVPAddrHi, UnusedVPAddrWidth,
+             VPOp,           VPBurstSize,    VPTicks,
+             VPDone,         VPError,        VPParam) ;
+
+      exit when VPOp /= POOL_COLLECT_OP ;
+      wait for 0 ns ;
+    end loop ;
 
     Done  := VPDone  ;
     Error := VPError ;
@@ -955,14 +1307,7 @@ package body OsvvmTestCoSimPkg is
           if BurstType'val(VPParam) /= BURST_TRANS then
 
             -- Pop the bytes from the read fifo and write them to the co-sim receive buffer
-            RdData := (others => '0');
-
-            for bidx in 0 to VPBurstSize-1 loop
-              Pop(RxRec.BurstFifo, RdData(7 downto 0)) ;
-              RdDataInt := to_integer(unsigned(RdData(7 downto 0))) ;
-
-              VSetBurstRdByte(NodeNum, bidx, RdDataInt) ;
-            end loop ;
+            CoSimPopBurstData(RxRec.BurstFifo, VPBurstSize, NodeNum) ;
 
           end if ;
 
@@ -972,14 +1317,7 @@ package body OsvvmTestCoSimPkg is
           if BurstType'val(VPParam) /= BURST_TRANS and Available then
 
             -- Pop the bytes from the read fifo and write them to the co-sim receive buffer
-            RdData := (others => '0');
-
-            for bidx in 0 to VPBurstSize-1 loop
-              Pop(RxRec.BurstFifo, RdData(7 downto 0)) ;
-              RdDataInt := to_integer(unsigned(RdData(7 downto 0))) ;
-
-              VSetBurstRdByte(NodeNum, bidx, RdDataInt) ;
-            end loop ;
+            CoSimPopBurstData(RxRec.BurstFifo, VPBurstSize, NodeNum) ;
           end if ;
 
         when SEND_BURST | SEND_BURST_ASYNC | CHECK_BURST | TRY_CHECK_BURST =>
@@ -1009,13 +1347,7 @@ package body OsvvmTestCoSimPkg is
               -- Fetch the bytes from the co-sim send buffer and push to the transaction write fifo
               if BurstType'val(VPDataOut) /= BURST_TRANS  and Available then
 
-                for bidx in 0 to VPBurstSize-1 loop
-
-                  VGetBurstWrByte(NodeNum, bidx, WrDataInt) ;
-                  WrByteData := to_signed(WrDataInt, WrByteData'length) ;
-                  Push(Fifo, std_logic_vector(WrByteData(7 downto 0))) ;
-
-                end loop ;
+                CoSimPushBurstData(Fifo, VPBurstSize, NodeNum) ;
               end if ;
 
               -- Instigate a transaction if not a PUSH operation
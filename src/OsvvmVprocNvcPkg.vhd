@@ -13,6 +13,8 @@
 --
 --  Revision History:
 --    Date      Version    Description
+--    10/2026   ????.??    Added VGetQueueTrans and VPutQueueResp
+--    10/2026   ????.??    Added VGetBurstWrWord and VSetBurstRdWord
 --    09/2025   ????.??    Added VIrqVec
 --    05/2023   2023.05    Refactoring to support responder and stream functionality
 --    09/2022   2023.01    Initial revision
@@ -83,6 +85,43 @@ package OsvvmVprocPkg is
   ) ;
   attribute foreign of VIrqVec : procedure is "VHPIDIRECT VIrqVec" ;
 
+  procedure VGetBurstWrWord (
+    node        : in  integer ;
+    idx         : in  integer ;
+    data        : out integer ;
+    datahi      : out integer
+  ) ;
+  attribute foreign of VGetBurstWrWord : procedure is "VHPIDIRECT VGetBurstWrWord" ;
+
+  procedure VSetBurstRdWord (
+    node        : in  integer ;
+    idx         : in  integer ;
+    data        : in  integer ;
+    datahi      : in  integer
+  ) ;
+  attribute foreign of VSetBurstRdWord : procedure is "VHPIDIRECT VSetBurstRdWord" ;
+
+  procedure VGetQueueTrans (
+    node        : in  integer ;
+    op          : out integer ;
+    addr        : out integer ;
+    addrhi      : out integer ;
+    addrwidth   : out integer ;
+    data        : out integer ;
+    datahi      : out integer ;
+    datawidth   : out integer ;
+    valid       : out integer
+  ) ;
+  attribute foreign of VGetQueueTrans : procedure is "VHPIDIRECT VGetQueueTrans" ;
+
+  procedure VPutQueueResp (
+    node        : in  integer ;
+    data        : in  integer ;
+    datahi      : in  integer ;
+    status      : in  integer
+  ) ;
+  attribute foreign of VPutQueueResp : procedure is "VHPIDIRECT VPutQueueResp" ;
+
 end ;
 
 package body OsvvmVprocPkg is
@@ -143,4 +182,49 @@ package body OsvvmVprocPkg is
     report "ERROR: foreign subprogram not called" severity error ;
   end ;
 
+  procedure VGetBurstWrWord (
+    node      : in  integer ;
+    idx       : in  integer ;
+    data      : out integer ;
+    datahi    : out integer
+  ) is
+  begin
+    report "ERROR: foreign subprogram not called" severity error ;
+  end ;
+
+  procedure VSetBurstRdWord (
+    node      : in  integer ;
+    idx       : in  integer ;
+    data      : in  integer ;
+    datahi    : in  integer
+  ) is
+  begin
+    report "ERROR: foreign subprogram not called" severity error ;
+  end ;
+
+  procedure VGetQueueTrans (
+    node      : in  integer ;
+    op        : out integer ;
+    addr      : out integer ;
+    addrhi    : out integer ;
+    addrwidth : out integer ;
+    data      : out integer ;
+    datahi    : out integer ;
+    datawidth : out integer ;
+    valid     : out integer
+  ) is
+  begin
+    report "ERROR: foreign subprogram not called" severity error ;
+  end ;
+
+  procedure VPutQueueResp (
+    node      : in  integer ;
+    data      : in  integer ;
+    datahi    : in  integer ;
+    status    : in  integer
+  ) is
+  begin
+    report "ERROR: foreign subprogram not called" severity error ;
+  end ;
+
 end;
@@ -13,6 +13,8 @@
 --
 --  Revision History:
 --    Date      Version    Description
+--    10/2026   ????.??    Added VGetQueueTrans and VPutQueueResp
+--    10/2026   ????.??    Added VGetBurstWrWord and VSetBurstRdWord
 --    09/2025   ???????    Added VIrqVec CoSim procedure
 --    07/2025   2025.??    Changes in support of future Python interface
 --    05/2023   2023.05    Refactoring to support responder and stream functionality
@@ -84,6 +86,43 @@ package OsvvmVprocPkg is
   ) ;
   attribute foreign of VIrqVec : procedure is "VIrqVec VProc.so" ;
 
+  procedure VGetBurstWrWord (
+    node        : in  integer ;
+    idx         : in  integer ;
+    data        : out integer ;
+    datahi      : out integer
+  ) ;
+  attribute foreign of VGetBurstWrWord : procedure is "VGetBurstWrWord VProc.so" ;
+
+  procedure VSetBurstRdWord (
+    node        : in  integer ;
+    idx         : in  integer ;
+    data        : in  integer ;
+    datahi      : in  integer
+  ) ;
+  attribute foreign of VSetBurstRdWord : procedure is "VSetBurstRdWord VProc.so" ;
+
+  procedure VGetQueueTrans (
+    node        : in  integer ;
+    op          : out integer ;
+    addr        : out integer ;
+    addrhi      : out integer ;
+    addrwidth   : out integer ;
+    data        : out integer ;
+    datahi      : out integer ;
+    datawidth   : out integer ;
+    valid       : out integer
+  ) ;
+  attribute foreign of VGetQueueTrans : procedure is "VGetQueueTrans VProc.so" ;
+
+  procedure VPutQueueResp (
+    node        : in  integer ;
+    data        : in  integer ;
+    datahi      : in  integer ;
+    status      : in  integer
+  ) ;
+  attribute foreign of VPutQueueResp : procedure is "VPutQueueResp VProc.so" ;
+
 end ;
 
 package body OsvvmVprocPkg is
@@ -144,4 +183,49 @@ package body OsvvmVprocPkg is
     report "ERROR: foreign subprogram not called" severity error ;
   end ;
 
+  procedure VGetBurstWrWord (
+    node      : in  integer ;
+    idx       : in  integer ;
+    data      : out integer ;
+    datahi    : out integer
+  ) is
+  begin
+    report "ERROR: foreign subprogram not called" severity error ;
+  end ;
+
+  procedure VSetBurstRdWord (
+    node      : in  integer ;
+    idx       : in  integer ;
+    data      : in  integer ;
+    datahi    : in  integer
+  ) is
+  begin
+    report "ERROR: foreign subprogram not called" severity error ;
+  end ;
+
+  procedure VGetQueueTrans (
+    node      : in  integer ;
+    op        : out integer ;
+    addr      : out integer ;
+    addrhi    : out integer ;
+    addrwidth : out integer ;
+    data      : out integer ;
+    datahi    : out integer ;
+    datawidth : out integer ;
+    valid     : out integer
+  ) is
+  begin
+    report "ERROR: foreign subprogram not called" severity error ;
+  end ;
+
+  procedure VPutQueueResp (
+    node      : in  integer ;
+    data      : in  integer ;
+    datahi    : in  integer ;
+    status    : in  integer
+  ) is
+  begin
+    report "ERROR: foreign subprogram not called" severity error ;
+  end ;
+
 end;
\ No newline at end of file
@@ -18,6 +18,8 @@
 #
 #  Revision History:
 #    Date      Version    Description
+#    10/2026   ????.??    readpoll test covers HDL executed read polls, and polls ended
+#                         by interrupts
 #    12/2022   2023.01    Refactored to source scripts in Scripts/StartUpShared.tcl and 
 #                         analyze CoSim by calling CoSim/CoSim.pro in OsvvmLibraries/OsvvmLibraries.pro
 #     9/2022   --         Initial version
@@ -14,6 +14,8 @@
 --
 --  Revision History:
 --    Date      Version    Description
+--    10/2026   ????.??    Added masked read poll time out, and poll interrupted
+--                         by an interrupt request
 --    05/2023   2023.05    Initial revision
 --
 --
@@ -173,6 +175,23 @@ begin
     -- Send matching bit
     SendRead(SubordinateRec, Addr, X"0000_4000") ;
 
+    -- Masked poll, never matching, to time out after 4 reads
+    for i in 1 to 4 loop
+      SendRead(SubordinateRec, Addr, X"0000_00A5") ;
+    end loop ;
+
+    -- Masked poll, never matching, interrupted after 3 reads and polling on
+    -- to time out after 8 reads
+    for i in 1 to 8 loop
+      SendRead(SubordinateRec, Addr, X"0000_00A5") ;
+
+      if i = 3 then
+        gIntReq(0) <= force '1' ;
+      end if ;
+    end loop ;
+
+    gIntReq(0) <= release ;
+
     -- Wait for outputs to propagate and signal TestDone
     WaitForClock(SubordinateRec, 2) ;
     WaitForBarrier(TestDone) ;
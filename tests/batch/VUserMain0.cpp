@@ -0,0 +1,135 @@
+// ------------------------------------------------------------------------------
+//
+//  File Name:           VUserMain0.cpp
+//  Design Unit Name:    Co-simulation virtual processor test program
+//  Revision:            OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:          Simon Southwell      email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell   simon.southwell@gmail.com
+//
+//  Description:
+//      Co-simulation test of batched transactions
+//
+//  Developed by:
+//        Simon Southwell
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Initial revision
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// ------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+// Import VProc user API
+#include "OsvvmCosim.h"
+
+// I am node 0 context
+static int node  = 0;
+
+// Number of transactions in each batch, more than fit the submission queue
+static const int NUM_TRANS = 600;
+
+static vbatch_trans_t wbatch[NUM_TRANS];
+static vbatch_trans_t rbatch[NUM_TRANS];
+
+// ------------------------------------------------------------------------------
+// Main entry point for node 0 virtual processor software
+//
+// VUserMainX has no calling arguments. If runtime configuration required
+// then you'll need to read in a configuration file.
+//
+// ------------------------------------------------------------------------------
+
+extern "C" void VUserMain0()
+{
+    VPrint("VUserMain0(): node=%d\n", node);
+
+    bool        error = false;
+    std::string test_name("CoSim_batch");
+    OsvvmCosim  cosim(node, test_name);
+
+    int         num;
+
+    // Build a register map of mixed address and data widths, each entry
+    // in its own 64-bit slot
+    static const int widths[4] = {8, 16, 32, 64};
+
+    for (int idx = 0; idx < NUM_TRANS; idx++)
+    {
+        int      width = widths[idx % 4];
+        uint64_t mask  = (width == 64) ? ~0ULL : ((1ULL << width) - 1);
+
+        wbatch[idx].addr       = 0x2000 + idx * 8;
+        wbatch[idx].data       = (0xa55a5aa5c33c3cc3ULL ^ ((uint64_t)idx * 0x0101010101010101ULL)) & mask;
+        wbatch[idx].addr_width = (idx & 1) ? 64 : 32;
+        wbatch[idx].data_width = width;
+        wbatch[idx].prot       = 0;
+
+        rbatch[idx]            = wbatch[idx];
+        rbatch[idx].data       = 0;
+    }
+
+    if ((num = cosim.transWriteBatch(wbatch, NUM_TRANS)) != NUM_TRANS)
+    {
+        VPrint("***ERROR: unexpected number of batched writes. Got %d. Exp %d\n", num, NUM_TRANS);
+        error = true;
+    }
+
+    if ((num = cosim.transReadBatch(rbatch, NUM_TRANS)) != NUM_TRANS)
+    {
+        VPrint("***ERROR: unexpected number of batched reads. Got %d. Exp %d\n", num, NUM_TRANS);
+        error = true;
+    }
+
+    for (int idx = 0; idx < NUM_TRANS; idx++)
+    {
+        if (rbatch[idx].data != wbatch[idx].data)
+        {
+            VPrint("***ERROR: unexpected data value at 0x%04x. Got 0x%016llx. Exp 0x%016llx\n",
+                   (uint32_t)rbatch[idx].addr, (unsigned long long)rbatch[idx].data, (unsigned long long)wbatch[idx].data);
+            error = true;
+        }
+    }
+
+    // Queued transactions are executed before a batch, and their completions
+    // are unaffected by it
+    uint32_t tag;
+    uint64_t rdata;
+    int      status;
+
+    cosim.transQueueRead((uint32_t)0x2000, 0x55);
+    cosim.transReadBatch(rbatch, 1);
+
+    if (!cosim.transQueueGetResp(&tag, &rdata, &status) || tag != 0x55 || cosim.transQueueGetResp(&tag, &rdata, &status))
+    {
+        VPrint("***ERROR: unexpected queue completions after batch\n");
+        error = true;
+    }
+
+    // Flag to the simulation we're finished, after 10 more iterations
+    cosim.tick(10, true, error);
+
+    // If ever got this far then sleep forever
+    SLEEPFOREVER;
+}
+
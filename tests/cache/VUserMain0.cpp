@@ -0,0 +1,164 @@
+// ------------------------------------------------------------------------------
+//
+//  File Name:           VUserMain0.cpp
+//  Design Unit Name:    Co-simulation virtual processor test program
+//  Revision:            OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:          Simon Southwell      email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell   simon.southwell@gmail.com
+//
+//  Description:
+//      Co-simulation test of the user side read cache
+//
+//  Developed by:
+//        Simon Southwell
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Queued and batched write checks
+//    10/2026   ????.??    Initial revision
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// ------------------------------------------------------------------------------
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+// Import VProc user API
+#include "OsvvmCosim.h"
+
+// I am node 0 context
+static int node  = 0;
+
+// Cacheable range, of four cache lines
+static const uint32_t CACHE_BASE  = 0x3000;
+static const int      CACHE_WORDS = 64;
+
+// ------------------------------------------------------------------------------
+// Check a 32-bit word read and the cache statistics
+// ------------------------------------------------------------------------------
+
+static bool checkRead(OsvvmCosim &cosim, const uint32_t addr, const uint32_t exp, const uint64_t exp_hits, const uint64_t exp_misses)
+{
+    uint32_t rdata;
+    uint64_t hits, misses;
+
+    cosim.transRead(addr, &rdata);
+    cosim.cacheGetStats(&hits, &misses);
+
+    if (rdata != exp || hits != exp_hits || misses != exp_misses)
+    {
+        VPrint("***ERROR: unexpected read at 0x%04x. Got 0x%08x (%d hits, %d misses). Exp 0x%08x (%d hits, %d misses)\n",
+               addr, rdata, (int)hits, (int)misses, exp, (int)exp_hits, (int)exp_misses);
+        return true;
+    }
+
+    return false;
+}
+
+// ------------------------------------------------------------------------------
+// Main entry point for node 0 virtual processor software
+//
+// VUserMainX has no calling arguments. If runtime configuration required
+// then you'll need to read in a configuration file.
+//
+// ------------------------------------------------------------------------------
+
+extern "C" void VUserMain0()
+{
+    VPrint("VUserMain0(): node=%d\n", node);
+
+    bool        error = false;
+    std::string test_name("CoSim_cache");
+    OsvvmCosim  cosim(node, test_name);
+
+    for (int idx = 0; idx <= CACHE_WORDS; idx++)
+    {
+        cosim.transWrite(CACHE_BASE + idx * 4, (uint32_t)(0x1000 + idx));
+    }
+
+    cosim.cacheAddRange(CACHE_BASE, CACHE_WORDS * 4);
+
+    // A miss on the first word of each line, filling the line, with the rest hits
+    for (int idx = 0; idx < CACHE_WORDS; idx++)
+    {
+        error |= checkRead(cosim, CACHE_BASE + idx * 4, 0x1000 + idx, idx - idx / 16, idx / 16 + 1);
+    }
+
+    // Reads outside the range are not cached
+    error |= checkRead(cosim, CACHE_BASE + CACHE_WORDS * 4, 0x1000 + CACHE_WORDS, 60, 4);
+
+    // Single word writes are written through to cached lines
+    cosim.transWrite(CACHE_BASE + 0x10, (uint32_t)0xcafef00d);
+    error |= checkRead(cosim, CACHE_BASE + 0x10, 0xcafef00d, 61, 4);
+
+    // Reads of all widths and address widths are cached
+    uint8_t  rdata8;
+    uint16_t rdata16;
+    uint64_t rdata64;
+
+    cosim.transRead(CACHE_BASE + 0x11, &rdata8);
+    cosim.transRead(CACHE_BASE + 0x12, &rdata16);
+    cosim.transRead((uint64_t)(CACHE_BASE + 0x18), &rdata64);
+
+    if (rdata8 != 0xf0 || rdata16 != 0xcafe || rdata64 != 0x0000100700001006ULL)
+    {
+        VPrint("***ERROR: unexpected cached data. Got 0x%02x 0x%04x 0x%016llx\n", rdata8, rdata16, (unsigned long long)rdata64);
+        error = true;
+    }
+
+    // Burst writes invalidate the lines they overlap
+    uint8_t  wbuf[4] = {0x78, 0x56, 0x34, 0x12};
+
+    cosim.transBurstWrite(CACHE_BASE + 0x40, wbuf, 4);
+    error |= checkRead(cosim, CACHE_BASE + 0x40, 0x12345678, 64, 5);
+
+    // Queued writes are written through to cached lines
+    cosim.transQueueWrite(CACHE_BASE + 0x80, (uint32_t)0x5555aaaa);
+    cosim.transQueueFlush();
+    error |= checkRead(cosim, CACHE_BASE + 0x80, 0x5555aaaa, 65, 5);
+
+    // An explicit invalidate refetches the line
+    cosim.cacheInvalidate(CACHE_BASE + 0x80, 4);
+    error |= checkRead(cosim, CACHE_BASE + 0x80, 0x5555aaaa, 65, 6);
+
+    // With no ranges, reads are not cached
+    cosim.cacheClearRanges();
+    error |= checkRead(cosim, CACHE_BASE, 0x1000, 65, 6);
+
+    // Batched writes are written through to cached lines, with a write
+    // partly outside the range invalidating the line it overlaps
+    vbatch_trans_t wbatch[2] = {{CACHE_BASE + 0x04, 0xa5a5a5a5,            32, 32, 0},
+                                {CACHE_BASE + 0xf8, 0x0123456789abcdefULL, 32, 64, 0}};
+
+    cosim.cacheAddRange(CACHE_BASE, CACHE_WORDS * 4 - 4);
+    error |= checkRead(cosim, CACHE_BASE,        0x1000,        65, 7);
+    error |= checkRead(cosim, CACHE_BASE + 0xc0, 0x1000 + 0x30, 65, 8);
+
+    cosim.transWriteBatch(wbatch, 2);
+    error |= checkRead(cosim, CACHE_BASE + 0x04, 0xa5a5a5a5,    66, 8);
+    error |= checkRead(cosim, CACHE_BASE + 0xc0, 0x1000 + 0x30, 66, 9);
+    error |= checkRead(cosim, CACHE_BASE + 0xf8, 0x89abcdef,    67, 9);
+
+    // Flag to the simulation we're finished, after 10 more iterations
+    cosim.tick(10, true, error);
+
+    // If ever got this far then sleep forever
+    SLEEPFOREVER;
+}
@@ -0,0 +1,169 @@
+// ------------------------------------------------------------------------------
+//
+//  File Name:           VUserMain0.cpp
+//  Design Unit Name:    Co-simulation virtual processor test program
+//  Revision:            OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:          Simon Southwell      email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell   simon.southwell@gmail.com
+//
+//  Description:
+//      Co-simulation test of read futures
+//
+//  Developed by:
+//        Simon Southwell
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Added polling of a read future with ready()
+//    10/2026   ????.??    Added blocking reads with read futures outstanding
+//    10/2026   ????.??    Initial revision
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// ------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+// Import VProc user API
+#include "OsvvmCosim.h"
+
+// I am node 0 context
+static int node  = 0;
+
+// Number of reads outstanding, more than VP_FUTURE_SIZE
+static const uint32_t NUM_READS = 300;
+
+static OsvvmCosimReadFuture futures[NUM_READS];
+
+// ------------------------------------------------------------------------------
+// Main entry point for node 0 virtual processor software
+//
+// VUserMainX has no calling arguments. If runtime configuration required
+// then you'll need to read in a configuration file.
+//
+// ------------------------------------------------------------------------------
+
+extern "C" void VUserMain0()
+{
+    VPrint("VUserMain0(): node=%d\n", node);
+
+    bool        error = false;
+    std::string test_name("CoSim_future");
+    OsvvmCosim  cosim(node, test_name);
+
+    uint64_t    data;
+
+    for (uint32_t idx = 0; idx < NUM_READS; idx++)
+    {
+        cosim.transWrite((uint32_t)(idx * 4), (uint32_t)(0xa5000000 | idx));
+    }
+
+    // Issue a set of reads, and wait for them in reverse order, with the
+    // first wait returning the data of all of them
+    for (uint32_t idx = 0; idx < 16; idx++)
+    {
+        futures[idx] = cosim.transReadFuture((uint32_t)(idx * 4));
+    }
+
+    for (int idx = 15; idx >= 0; idx--)
+    {
+        if ((data = futures[idx].wait()) != (0xa5000000 | idx))
+        {
+            VPrint("***ERROR: unexpected future data. Got 0x%08x. Exp 0x%08x\n", (uint32_t)data, 0xa5000000 | idx);
+            error = true;
+        }
+
+        if (!futures[0].ready())
+        {
+            VPrint("***ERROR: future 0 not ready after waiting for future %d\n", idx);
+            error = true;
+        }
+    }
+
+    // Issue more reads than can be outstanding, mixed with writes to
+    // other addresses, the oldest being waited for when the limit is reached
+    for (uint32_t idx = 0; idx < NUM_READS; idx++)
+    {
+        futures[idx] = cosim.transReadFuture((uint32_t)(idx * 4), 16);
+
+        if ((idx % 32) == 0)
+        {
+            cosim.transWrite((uint32_t)(0x1000 + idx * 4), (uint32_t)idx);
+        }
+    }
+
+    for (uint32_t idx = NUM_READS - VP_FUTURE_SIZE; idx < NUM_READS; idx++)
+    {
+        if ((data = futures[idx].wait()) != (idx & 0xffff))
+        {
+            VPrint("***ERROR: unexpected future data. Got 0x%04x. Exp 0x%04x\n", (uint32_t)data, idx & 0xffff);
+            error = true;
+        }
+    }
+
+    // Blocking reads issued with read futures outstanding, whose read data
+    // the bus returns first, must get their own data
+    for (uint32_t idx = 0; idx < 8; idx++)
+    {
+        uint32_t rdata;
+
+        futures[idx] = cosim.transReadFuture((uint32_t)(idx * 4));
+
+        cosim.transRead((uint32_t)(0x1000 + idx * 128), &rdata);
+
+        if (rdata != idx * 32)
+        {
+            VPrint("***ERROR: unexpected read data with futures outstanding. Got 0x%08x. Exp 0x%08x\n", rdata, idx * 32);
+            error = true;
+        }
+    }
+
+    for (uint32_t idx = 0; idx < 8; idx++)
+    {
+        if ((data = futures[idx].wait()) != (0xa5000000 | idx))
+        {
+            VPrint("***ERROR: unexpected future data after blocking reads. Got 0x%08x. Exp 0x%08x\n", (uint32_t)data, 0xa5000000 | idx);
+            error = true;
+        }
+    }
+
+    // Polling ready() advances the simulation until the read data is fetched
+    OsvvmCosimReadFuture poll_future = cosim.transReadFuture((uint32_t)(5 * 4));
+    int                  polls       = 0;
+
+    while (!poll_future.ready() && polls < 100)
+    {
+        polls++;
+    }
+
+    if (polls == 100 || (data = poll_future.wait()) != (0xa5000000 | 5))
+    {
+        VPrint("***ERROR: polled future not ready after %d polls, or unexpected data 0x%08x\n", polls, (uint32_t)data);
+        error = true;
+    }
+
+    // Flag to the simulation we're finished, after 10 more iterations
+    cosim.tick(10, true, error);
+
+    // If ever got this far then sleep forever
+    SLEEPFOREVER;
+}
+
@@ -0,0 +1,233 @@
+// ------------------------------------------------------------------------------
+//
+//  File Name:           VUserMain0.cpp
+//  Design Unit Name:    Co-simulation virtual processor test program
+//  Revision:            OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:          Simon Southwell      email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell   simon.southwell@gmail.com
+//
+//  Description:
+//      Co-simulation test of the interrupt event queue, with interrupt
+//      vector events raised by CoSimIrq delivered in order, with
+//      timestamps, to the interrupt callback on the user thread, and
+//      then to a dedicated ISR thread draining the queue
+//
+//  Developed by:
+//        Simon Southwell
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    ISR thread sleeps in irqWait
+//    10/2026   ????.??    Initial revision
+//    10/2026   ????.??    Added ISR thread draining case
+//    10/2026   ????.??    Check the exact number of interrupt events, and identify
+//                         the ISR thread rather than the user thread
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// ------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <atomic>
+#include <pthread.h>
+
+// Import VProc user API
+#include "OsvvmCosim.h"
+
+// I am node 0 context
+static int node  = 0;
+
+// Maximum number of interrupt events recorded
+static const int MAX_EVENTS = 64;
+
+// Number of interrupt events raised, as for the edges of gIntReq(0) in the
+// TbAb_CoSim InterruptProc, and those of tests/irqqueue/nullsim_irqs.txt
+static const int EXP_EVENTS = 4;
+
+static OsvvmCosim* cosim;
+static pthread_t   isr_thread;
+
+static int         num_events = 0;
+static int         vec[MAX_EVENTS];
+static uint64_t    timestamp[MAX_EVENTS];
+static bool        wrong_thread = false;
+
+static std::atomic<bool> isr_phase(false);
+static std::atomic<bool> isr_stop(false);
+
+// Set only on the ISR thread. The user code's thread is the simulator
+// side's, a coroutine's, or a shared pool worker's, so is not named
+static thread_local bool on_isr_thread = false;
+
+// ------------------------------------------------------------------------------
+// Interrupt callback, recording each event's vector and timestamp. Called
+// on the user thread, or only on the ISR thread once that's draining
+// ------------------------------------------------------------------------------
+
+static int interruptCB(int int_vec)
+{
+    if (on_isr_thread != isr_phase.load())
+    {
+        wrong_thread = true;
+    }
+
+    if (num_events < MAX_EVENTS)
+    {
+        vec[num_events]       = int_vec;
+        timestamp[num_events] = cosim->irqEventTime();
+    }
+
+    num_events++;
+
+    return 0;
+}
+
+// ------------------------------------------------------------------------------
+// ISR thread, sleeping until there are interrupt events to drain, until
+// woken to stop, with a final drain for any events raised before the stop
+// ------------------------------------------------------------------------------
+
+static void* isrThread(void* /*arg*/)
+{
+    on_isr_thread = true;
+
+    while (!isr_stop.load())
+    {
+        cosim->irqWait();
+    }
+
+    cosim->irqDrain();
+
+    return NULL;
+}
+
+// ------------------------------------------------------------------------------
+// Main entry point for node 0 virtual processor software
+//
+// VUserMainX has no calling arguments. If runtime configuration required
+// then you'll need to read in a configuration file.
+//
+// ------------------------------------------------------------------------------
+
+extern "C" void VUserMain0()
+{
+    VPrint("VUserMain0(): node=%d\n", node);
+
+    bool        error = false;
+    std::string test_name("CoSim_irqqueue");
+
+    cosim       = new OsvvmCosim(node, test_name);
+
+    cosim->regInterruptCB(interruptCB);
+
+    // Interleave transactions with single and multi-tick waits, for the
+    // interrupt events to be raised between message exchanges
+    for (int loop = 0; loop < 20; loop++)
+    {
+        uint32_t rdata;
+
+        cosim->transWrite((uint32_t)(0x1000 + loop * 4), (uint32_t)loop);
+        cosim->transRead((uint32_t)(0x1000 + loop * 4), &rdata);
+
+        if (rdata != (uint32_t)loop)
+        {
+            VPrint("***ERROR: unexpected read data at 0x%04x. Got 0x%08x. Exp 0x%08x\n", 0x1000 + loop * 4, rdata, loop);
+            error = true;
+        }
+
+        cosim->tick(1);
+        cosim->tick(20);
+    }
+
+    int user_events = num_events;
+
+    // Hand the draining of interrupt events to an ISR thread, with the
+    // user thread continuing to make transactions
+    cosim->irqSetExchDrain(false);
+    isr_phase.store(true);
+
+    if (pthread_create(&isr_thread, NULL, isrThread, NULL) != 0)
+    {
+        VPrint("***ERROR: failed to create ISR thread\n");
+        error = true;
+    }
+    else
+    {
+        for (int loop = 0; loop < 20; loop++)
+        {
+            uint32_t rdata;
+
+            cosim->transWrite((uint32_t)(0x2000 + loop * 4), (uint32_t)loop);
+            cosim->transRead((uint32_t)(0x2000 + loop * 4), &rdata);
+
+            if (rdata != (uint32_t)loop)
+            {
+                VPrint("***ERROR: unexpected read data at 0x%04x. Got 0x%08x. Exp 0x%08x\n", 0x2000 + loop * 4, rdata, loop);
+                error = true;
+            }
+
+            cosim->tick(1);
+            cosim->tick(20);
+        }
+
+        isr_stop.store(true);
+        cosim->irqWake();
+        pthread_join(isr_thread, NULL);
+    }
+
+    VPrint("VUserMain0: saw %d interrupt events, %d drained by the ISR thread\n", num_events, num_events - user_events);
+
+    // The interrupt request is a single bit, starting inactive, so each
+    // event must toggle it, with none lost, in timestamp order
+    if (num_events != EXP_EVENTS)
+    {
+        VPrint("***ERROR: unexpected number of interrupt events. Got %d. Exp %d\n", num_events, EXP_EVENTS);
+        error = true;
+    }
+
+    for (int idx = 0; idx < num_events && idx < MAX_EVENTS; idx++)
+    {
+        if (vec[idx] != ((idx & 1) ? 0 : 1))
+        {
+            VPrint("***ERROR: unexpected vector for interrupt event %d. Got %d. Exp %d\n", idx, vec[idx], (idx & 1) ? 0 : 1);
+            error = true;
+        }
+
+        if (idx > 0 && timestamp[idx] < timestamp[idx-1])
+        {
+            VPrint("***ERROR: interrupt event %d timestamp %llu earlier than previous event's %llu\n",
+                   idx, (unsigned long long)timestamp[idx], (unsigned long long)timestamp[idx-1]);
+            error = true;
+        }
+    }
+
+    if (wrong_thread)
+    {
+        VPrint("***ERROR: interrupt callback not called on the draining thread\n");
+        error = true;
+    }
+
+    // Flag to the simulation we're finished, after 10 more iterations
+    cosim->tick(10, true, error);
+
+    // If ever got this far then sleep forever
+    SLEEPFOREVER;
+}
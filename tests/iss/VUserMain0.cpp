@@ -22,6 +22,10 @@
 
 static const int node = 0;
 
+// Size of the test program's text segment, from address 0, fetched through the
+// co-simulation read cache
+static const uint64_t text_size = 0x1000;
+
 // Type definition for write transaction, for use in TCP/IP socket script generation
 typedef struct {
     uint32_t addr;
@@ -194,14 +198,22 @@ extern "C" void VUserMain0()
     cfg.gdb_mode             = false;
     cfg.gdb_ip_portnum       = 0xc000;
 
-    // Open up a socket script file
-    sktfp = fopen("sktscript.txt", "w");
+    // Open up a socket script file, unless the co-simulation library is recording
+    // a binary trace, which Scripts/cosim_trace.py -s converts to a socket script
+    if (getenv("OSVVM_COSIM_TRACE") == NULL)
+    {
+        sktfp = fopen("sktscript.txt", "w");
+    }
 
     // Create a new cpu object
     rv32* pCpu               = new rv32();
 
     pCpu->register_ext_mem_callback(memcosim);
 
+    // Instruction fetches from the text segment are served from the read cache,
+    // with each line filled by a single burst read
+    cosim.cacheAddRange(0, text_size);
+
     // If GDB mode not configured, simply run the specified program
     if (!cfg.gdb_mode)
     {
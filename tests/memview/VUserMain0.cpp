@@ -0,0 +1,170 @@
+// ------------------------------------------------------------------------------
+//
+//  File Name:           VUserMain0.cpp
+//  Design Unit Name:    Co-simulation virtual processor test program
+//  Revision:            OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:          Simon Southwell      email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell   simon.southwell@gmail.com
+//
+//  Description:
+//      Co-simulation test of the write combining memory view
+//
+//  Developed by:
+//        Simon Southwell
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Signed load checks
+//    10/2026   ????.??    Out of window access checks
+//    10/2026   ????.??    Initial revision
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// ------------------------------------------------------------------------------
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+// Import VProc user API
+#include "OsvvmCosim.h"
+#include "OsvvmCosimMemView.h"
+
+// I am node 0 context
+static int node  = 0;
+
+// Number of bytes copied, spanning several write combining buffers
+static const int NUM_BYTES = 1000;
+
+static uint8_t wbuf[NUM_BYTES];
+static uint8_t rbuf[NUM_BYTES];
+
+// ------------------------------------------------------------------------------
+// Main entry point for node 0 virtual processor software
+//
+// VUserMainX has no calling arguments. If runtime configuration required
+// then you'll need to read in a configuration file.
+//
+// ------------------------------------------------------------------------------
+
+extern "C" void VUserMain0()
+{
+    VPrint("VUserMain0(): node=%d\n", node);
+
+    bool        error = false;
+    std::string test_name("CoSim_memview");
+    OsvvmCosim  cosim(node, test_name);
+
+    // A 32-bit and a 64-bit addressed view of the same memory
+    OsvvmCosimMemView mem32(cosim, 0x4000, 0x1000);
+    OsvvmCosimMemView mem64(cosim, 0x4000, 0x1000, true);
+
+    // Byte by byte copy, combined into bursts, read back as a burst
+    for (int idx = 0; idx < NUM_BYTES; idx++)
+    {
+        wbuf[idx] = (uint8_t)(idx * 7 + 3);
+    }
+
+    mem32.write(1, wbuf, NUM_BYTES);
+    mem32.read(1, rbuf, NUM_BYTES);
+
+    for (int idx = 0; idx < NUM_BYTES; idx++)
+    {
+        if (rbuf[idx] != wbuf[idx])
+        {
+            VPrint("***ERROR: unexpected copied byte at offset 0x%03x. Got 0x%02x. Exp 0x%02x\n", idx + 1, rbuf[idx], wbuf[idx]);
+            error = true;
+        }
+    }
+
+    // Consecutive typed stores, read back with typed loads
+    for (int idx = 0; idx < 64; idx++)
+    {
+        mem64.store<uint32_t>(0x400 + idx * 4, 0xc0de0000 | idx);
+    }
+
+    mem64.fence();
+
+    for (int idx = 0; idx < 64; idx++)
+    {
+        uint32_t rdata = mem32.load<uint32_t>(0x400 + idx * 4);
+
+        if (rdata != (0xc0de0000U | idx))
+        {
+            VPrint("***ERROR: unexpected word at offset 0x%03x. Got 0x%08x. Exp 0x%08x\n", 0x400 + idx * 4, rdata, 0xc0de0000U | idx);
+            error = true;
+        }
+    }
+
+    // Non-contiguous and single stores of each width, with loads fencing buffered stores
+    mem32.store<uint64_t>(0x800, 0x0123456789abcdefULL);
+    mem32.store<uint16_t>(0x810, 0xbeef);
+    mem32.store<uint8_t> (0x812, 0x5a);
+    mem32.store<uint32_t>(0x820, 0xfeedf00d);
+
+    uint64_t d64 = mem32.load<uint64_t>(0x800);
+    uint16_t d16 = mem64.load<uint16_t>(0x810);
+    uint8_t  d8  = mem64.load<uint8_t> (0x812);
+    uint32_t d32 = mem64.load<uint32_t>(0x820);
+
+    if (d64 != 0x0123456789abcdefULL || d16 != 0xbeef || d8 != 0x5a || d32 != 0xfeedf00d)
+    {
+        VPrint("***ERROR: unexpected single store data. Got 0x%016llx 0x%04x 0x%02x 0x%08x\n", (unsigned long long)d64, d16, d8, d32);
+        error = true;
+    }
+
+    // Signed loads of the stored words
+    int32_t  s32 = mem64.load<int32_t>(0x820);
+    int8_t   s8  = mem32.load<int8_t> (0x812);
+    int64_t  s64 = mem64.load<int64_t>(0x800);
+
+    if (s32 != (int32_t)0xfeedf00d || s8 != 0x5a || s64 != 0x0123456789abcdefLL)
+    {
+        VPrint("***ERROR: unexpected signed load data. Got %d %d %lld\n", s32, s8, (long long)s64);
+        error = true;
+    }
+
+    // Accesses outside the window are skipped, with loads returning zero
+    uint32_t edge[2];
+
+    cosim.transWrite((uint32_t)0x4ffc, (uint32_t)0);
+    cosim.transWrite((uint32_t)0x5000, (uint32_t)0);
+
+    mem32.store<uint32_t>(0xffe, 0xdeadbeef);
+    mem32.write(0xf00, wbuf, 0x200);
+    mem32.fence();
+
+    cosim.transRead((uint32_t)0x4ffc, &edge[0]);
+    cosim.transRead((uint32_t)0x5000, &edge[1]);
+
+    d16 = mem64.load<uint16_t>(0x1000);
+    d64 = mem64.load<uint64_t>(~0ULL);
+
+    if (edge[0] != 0 || edge[1] != 0 || d16 != 0 || d64 != 0 || mem32.getErrors() != 2 || mem64.getErrors() != 2)
+    {
+        VPrint("***ERROR: unexpected out of window access results. Got 0x%08x 0x%08x 0x%04x 0x%016llx, %d and %d errors\n",
+               edge[0], edge[1], d16, (unsigned long long)d64, mem32.getErrors(), mem64.getErrors());
+        error = true;
+    }
+
+    // Flag to the simulation we're finished, after 10 more iterations
+    cosim.tick(10, true, error);
+
+    // If ever got this far then sleep forever
+    SLEEPFOREVER;
+}
@@ -0,0 +1,170 @@
+// ------------------------------------------------------------------------------
+//
+//  File Name:           VUserMain0.cpp
+//  Design Unit Name:    Co-simulation virtual processor test program
+//  Revision:            OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:          Simon Southwell      email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell   simon.southwell@gmail.com
+//
+//  Description:
+//      Co-simulation test of queued transactions
+//
+//  Developed by:
+//        Simon Southwell
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Added completion queue limit of queued transactions
+//    10/2026   ????.??    Initial revision
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// ------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+// Import VProc user API
+#include "OsvvmCosim.h"
+
+// I am node 0 context
+static int node  = 0;
+
+// Number of transactions queued in each direction
+static const uint32_t NUM_TRANS = 300;
+
+// ------------------------------------------------------------------------------
+// Main entry point for node 0 virtual processor software
+//
+// VUserMainX has no calling arguments. If runtime configuration required
+// then you'll need to read in a configuration file.
+//
+// ------------------------------------------------------------------------------
+
+extern "C" void VUserMain0()
+{
+    VPrint("VUserMain0(): node=%d\n", node);
+
+    bool        error = false;
+    std::string test_name("CoSim_queue");
+    OsvvmCosim  cosim(node, test_name);
+
+    uint32_t    tag;
+    uint64_t    rdata;
+    int         status;
+    uint32_t    ncompl = 0;
+
+    // Queue writes and then reads of the written data, flushing in batches
+    // that fit the completion queue and checking the completions, which
+    // are returned in order. Reads are tagged from NUM_TRANS.
+    for (uint32_t idx = 0; idx < 2 * NUM_TRANS; idx++)
+    {
+        if (idx < NUM_TRANS)
+        {
+            cosim.transQueueWrite(idx * 4, 0x5a000000 | idx, idx);
+        }
+        else
+        {
+            cosim.transQueueRead((idx - NUM_TRANS) * 4, idx);
+        }
+
+        if (((idx + 1) % 64) == 0 || idx == 2 * NUM_TRANS - 1)
+        {
+            cosim.transQueueFlush();
+
+            while (cosim.transQueueGetResp(&tag, &rdata, &status))
+            {
+                uint32_t expval = 0x5a000000 | (tag - NUM_TRANS);
+
+                if (tag != ncompl++ || (tag >= NUM_TRANS && (uint32_t)rdata != expval))
+                {
+                    VPrint("***ERROR: unexpected completion. Got tag %d data 0x%08x. Exp tag %d\n",
+                           tag, (uint32_t)rdata, ncompl-1);
+                    error = true;
+                }
+            }
+        }
+    }
+
+    if (ncompl != 2 * NUM_TRANS)
+    {
+        VPrint("***ERROR: unexpected number of completions. Got %d. Exp %d\n", ncompl, 2 * NUM_TRANS);
+        error = true;
+    }
+
+    // Only as many transactions are queued as there is room for their
+    // completions, so a synchronous read is never executed ahead of any
+    uint32_t nqueued = 0;
+
+    while (nqueued < 2 * VP_QUEUE_SIZE && cosim.transQueueWrite((uint32_t)(0x2000 + nqueued * 4), nqueued, nqueued))
+    {
+        nqueued++;
+    }
+
+    if (nqueued != VP_QUEUE_SIZE)
+    {
+        VPrint("***ERROR: unexpected number of queued transactions. Got %d. Exp %d\n", nqueued, VP_QUEUE_SIZE);
+        error = true;
+    }
+
+    uint32_t rdata32;
+
+    cosim.transRead((uint32_t)(0x2000 + (nqueued - 1) * 4), &rdata32);
+
+    if (rdata32 != nqueued - 1)
+    {
+        VPrint("***ERROR: unexpected data value after queued writes. Got 0x%08x. Exp 0x%08x\n", rdata32, nqueued - 1);
+        error = true;
+    }
+
+    for (ncompl = 0; cosim.transQueueGetResp(&tag, &rdata, &status); ncompl++)
+    {
+        if (tag != ncompl)
+        {
+            VPrint("***ERROR: unexpected completion. Got tag %d. Exp tag %d\n", tag, ncompl);
+            error = true;
+        }
+    }
+
+    if (ncompl != nqueued)
+    {
+        VPrint("***ERROR: unexpected number of completions. Got %d. Exp %d\n", ncompl, nqueued);
+        error = true;
+    }
+
+    // A queued write is executed before a following synchronous read
+    uint32_t data;
+
+    cosim.transQueueWrite((uint32_t)0x1000, (uint32_t)0x12345678);
+    cosim.transRead((uint32_t)0x1000, &data);
+
+    if (data != 0x12345678)
+    {
+        VPrint("***ERROR: unexpected data value. Got 0x%08x. Exp 0x%08x\n", data, 0x12345678);
+        error = true;
+    }
+
+    // Flag to the simulation we're finished, after 10 more iterations
+    cosim.tick(10, true, error);
+
+    // If ever got this far then sleep forever
+    SLEEPFOREVER;
+}
+
@@ -16,6 +16,8 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   ????.??    Added masked read poll time out, and poll interrupted
+//                         with a registered interrupt callback
 //    09/2022   2022       Initial revision
 //
 //  This file is part of OSVVM.
@@ -49,6 +51,21 @@
 // I am node 0 context
 static int node  = 0;
 
+static int irq_vec   = 0;
+static int irq_calls = 0;
+
+// ------------------------------------------------------------------------------
+// Interrupt callback, recording the interrupt vector
+// ------------------------------------------------------------------------------
+
+static int interruptCB(int int_vec)
+{
+    irq_vec = int_vec;
+    irq_calls++;
+
+    return 0;
+}
+
 // ------------------------------------------------------------------------------
 // Main entry point for node 0 virtual processor software
 //
@@ -79,6 +96,36 @@ extern "C" void VUserMain0()
         VPrint("***ERROR: unexpected data value. Got 0x%08x. Exp 0x%08x\n", data, expval);
         error = true;
     }
+
+    // A masked poll that never matches times out after the maximum number of reads
+    int      iterations;
+    bool     matched = cosim.transReadPollMask(addr, &data, 0xff, 0x5a, 2, 4, &iterations);
+
+    if (matched || iterations != 4 || data != 0xa5)
+    {
+        VPrint("***ERROR: unexpected poll result. Got %d, %d reads and data 0x%08x. Exp 0, 4 reads and data 0x000000a5\n",
+               matched, iterations, data);
+        error = true;
+    }
+
+    // With an interrupt callback registered, a poll is ended by an interrupt for the
+    // callback to be run, and then polls on for the remaining reads
+    cosim.regInterruptCB(interruptCB);
+
+    matched = cosim.transReadPollMask(addr, &data, 0xff, 0x5a, 2, 8, &iterations);
+
+    if (matched || iterations != 8 || data != 0xa5)
+    {
+        VPrint("***ERROR: unexpected interrupted poll result. Got %d, %d reads and data 0x%08x. Exp 0, 8 reads and data 0x000000a5\n",
+               matched, iterations, data);
+        error = true;
+    }
+
+    if (irq_calls == 0 || irq_vec == 0)
+    {
+        VPrint("***ERROR: interrupt callback not run during poll. Got %d calls, vector %d\n", irq_calls, irq_vec);
+        error = true;
+    }
     
     // Flag to the simulation we're finished, after 10 more iterations
     cosim.tick(10, true, error);
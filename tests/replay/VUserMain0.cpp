@@ -0,0 +1,185 @@
+// ------------------------------------------------------------------------------
+//
+//  File Name:           VUserMain0.cpp
+//  Design Unit Name:    Co-simulation virtual processor test program
+//  Revision:            OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:          Simon Southwell      email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell   simon.southwell@gmail.com
+//
+//  Description:
+//      Co-simulation test of trace replay, from a generated socket script
+//
+//  Developed by:
+//        Simon Southwell
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Binary trace record and replay check
+//    10/2026   ????.??    Initial revision
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// ------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+// Import VProc user API
+#include "OsvvmCosim.h"
+#include "OsvvmCosimReplay.h"
+#include "OsvvmVTrace.h"
+
+// I am node 0 context
+static int node  = 0;
+
+// Socket script replayed, with expected data on reads, and one deliberate mismatch
+static const char* script_name = "replay_script.txt";
+static const char* script[]    =
+{
+    "# Co-simulation replay test script",
+    "M80001000,4:12345678",
+    "M80001004,2:9abc",
+    "M80001006,1:de",
+    "M1080002000,8:0123456789abcdef",
+    "m80001000,4:12345678",
+    "m80001004,2:9abc",
+    "m80001006,1:de",
+    "m80001000,4",
+    "m1080002000,8:0123456789abcdef",
+    "m80001004,4:00000000",
+    "D"
+};
+
+static const int NUM_TRANS      = 10;
+static const int NUM_MISMATCHES = 1;
+
+// Binary trace recorded, and replayed, with one read changed after recording
+static const char*    trace_name      = "replay_trace.bin";
+static const uint32_t TRACE_BASE      = 0x80003000;
+static const uint64_t TRACE_BASE64    = 0x1080004000ULL;
+static const int      NUM_TRACE_TRANS = 7;
+
+// ------------------------------------------------------------------------------
+// Record a binary trace of this node's transactions, reload it and replay it,
+// returning true on error
+// ------------------------------------------------------------------------------
+
+static bool replayBinary(OsvvmCosimReplay &replay)
+{
+#if !defined(_WIN32)
+    OsvvmCosim cosim(node);
+    uint32_t   rdata32;
+    uint16_t   rdata16;
+    uint64_t   rdata64;
+
+    // Initialise a word read by the trace, but not written by it
+    cosim.transWrite(TRACE_BASE + 8, (uint32_t)0x0badf00d);
+
+    setenv(VP_TRACE_ENV,      trace_name, 1);
+    setenv(VP_TRACE_RECS_ENV, "64",       1);
+    VTraceInit();
+
+    cosim.transWrite(TRACE_BASE,       (uint32_t)0x11223344);
+    cosim.transWrite(TRACE_BASE + 4,   (uint16_t)0xbeef);
+    cosim.transWrite(TRACE_BASE64,     (uint64_t)0x5566778899aabbccULL);
+    cosim.transRead (TRACE_BASE,       &rdata32);
+    cosim.transRead (TRACE_BASE + 4,   &rdata16);
+    cosim.transRead (TRACE_BASE64,     &rdata64);
+    cosim.transRead (TRACE_BASE + 8,   &rdata32);
+
+    if (!replay.load(trace_name))
+    {
+        return true;
+    }
+
+    if (replay.getNumTrans() != NUM_TRACE_TRANS)
+    {
+        VPrint("***ERROR: unexpected number of traced transactions loaded. Got %d. Exp %d\n", replay.getNumTrans(), NUM_TRACE_TRANS);
+        return true;
+    }
+
+    // Change the word read, but not written, so that its replayed read mismatches
+    cosim.transWrite(TRACE_BASE + 8, (uint32_t)0xfeedface);
+
+    if (replay.run() != 1)
+    {
+        VPrint("***ERROR: unexpected number of traced read mismatches. Got %d. Exp 1\n", replay.getMismatches());
+        return true;
+    }
+#endif
+
+    return false;
+}
+
+// ------------------------------------------------------------------------------
+// Main entry point for node 0 virtual processor software
+//
+// VUserMainX has no calling arguments. If runtime configuration required
+// then you'll need to read in a configuration file.
+//
+// ------------------------------------------------------------------------------
+
+extern "C" void VUserMain0()
+{
+    VPrint("VUserMain%d()\n", node);
+
+    bool             error = false;
+    OsvvmCosimReplay replay(node, "CoSim_replay");
+    FILE*            fp;
+
+    // Generate the socket script to be replayed
+    if ((fp = fopen(script_name, "w")) == NULL)
+    {
+        VPrint("***ERROR: failed to create %s\n", script_name);
+        error = true;
+    }
+    else
+    {
+        for (unsigned idx = 0; idx < sizeof(script)/sizeof(script[0]); idx++)
+        {
+            fprintf(fp, "%s\n", script[idx]);
+        }
+
+        fclose(fp);
+
+        if (!replay.load(script_name))
+        {
+            error = true;
+        }
+        else if (replay.getNumTrans() != NUM_TRANS)
+        {
+            VPrint("***ERROR: unexpected number of transactions loaded. Got %d. Exp %d\n", replay.getNumTrans(), NUM_TRANS);
+            error = true;
+        }
+        else if (replay.run() != NUM_MISMATCHES)
+        {
+            VPrint("***ERROR: unexpected number of read mismatches. Got %d. Exp %d\n", replay.getMismatches(), NUM_MISMATCHES);
+            error = true;
+        }
+    }
+
+    error |= replayBinary(replay);
+
+    // Flag to the simulation we're finished, after 10 more iterations
+    replay.tick(10, true, error);
+
+    // If ever got this far then sleep forever
+    SLEEPFOREVER;
+}
@@ -0,0 +1,137 @@
+// ------------------------------------------------------------------------------
+//
+//  File Name:           VUserMain0.cpp
+//  Design Unit Name:    Co-simulation virtual processor test program
+//  Revision:            OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:          Simon Southwell      email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell   simon.southwell@gmail.com
+//
+//  Description:
+//      Co-simulation test of scatter-gather burst transactions
+//
+//  Developed by:
+//        Simon Southwell
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   ????.??    Initial revision
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// ------------------------------------------------------------------------------
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+
+// Import VProc user API
+#include "OsvvmCosim.h"
+
+// I am node 0 context
+static int node  = 0;
+
+// Frame of a header, a payload larger than a burst buffer, and a trailer
+static const int HDR_SIZE     = 14;
+static const int PAYLOAD_SIZE = 5000;
+static const int TRLR_SIZE    = 4;
+static const int FRAME_SIZE   = HDR_SIZE + PAYLOAD_SIZE + TRLR_SIZE;
+
+static uint8_t hdr[HDR_SIZE];
+static uint8_t payload[PAYLOAD_SIZE];
+static uint8_t trlr[TRLR_SIZE];
+static uint8_t frame[FRAME_SIZE];
+
+// ------------------------------------------------------------------------------
+// Compare buffers, reporting the first mismatch
+// ------------------------------------------------------------------------------
+
+static bool compare(const char* what, const uint8_t* got, const uint8_t* exp, const int len)
+{
+    for (int idx = 0; idx < len; idx++)
+    {
+        if (got[idx] != exp[idx])
+        {
+            VPrint("***ERROR: unexpected %s byte %d. Got 0x%02x. Exp 0x%02x\n", what, idx, got[idx], exp[idx]);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// ------------------------------------------------------------------------------
+// Main entry point for node 0 virtual processor software
+//
+// VUserMainX has no calling arguments. If runtime configuration required
+// then you'll need to read in a configuration file.
+//
+// ------------------------------------------------------------------------------
+
+extern "C" void VUserMain0()
+{
+    VPrint("VUserMain0(): node=%d\n", node);
+
+    bool        error = false;
+    std::string test_name("CoSim_sgburst");
+    OsvvmCosim  cosim(node, test_name);
+
+    for (int idx = 0; idx < HDR_SIZE; idx++)     hdr[idx]     = 0xa0 + idx;
+    for (int idx = 0; idx < PAYLOAD_SIZE; idx++) payload[idx] = idx * 13 + 1;
+    for (int idx = 0; idx < TRLR_SIZE; idx++)    trlr[idx]    = 0xf0 + idx;
+
+    memcpy(frame,                           hdr,     HDR_SIZE);
+    memcpy(frame + HDR_SIZE,                payload, PAYLOAD_SIZE);
+    memcpy(frame + HDR_SIZE + PAYLOAD_SIZE, trlr,    TRLR_SIZE);
+
+    vburst_iov_t iov[3] = {{hdr, HDR_SIZE}, {payload, PAYLOAD_SIZE}, {trlr, TRLR_SIZE}};
+
+    // Frame gathered from its segments, read back as a contiguous burst
+    uint8_t rframe[FRAME_SIZE];
+
+    cosim.transBurstWrite((uint32_t)0x8000, iov, 3);
+    cosim.transBurstRead((uint32_t)0x8000, rframe, FRAME_SIZE);
+
+    error |= compare("gathered frame", rframe, frame, FRAME_SIZE);
+
+    // Contiguous frame, read back scattered to segments, with 64-bit addresses
+    memset(hdr,     0, HDR_SIZE);
+    memset(payload, 0, PAYLOAD_SIZE);
+    memset(trlr,    0, TRLR_SIZE);
+
+    cosim.transBurstWrite((uint64_t)0x10000, frame, FRAME_SIZE);
+    cosim.transBurstRead((uint64_t)0x10000, iov, 3);
+
+    error |= compare("scattered header",  hdr,     frame,                           HDR_SIZE);
+    error |= compare("scattered payload", payload, frame + HDR_SIZE,                PAYLOAD_SIZE);
+    error |= compare("scattered trailer", trlr,    frame + HDR_SIZE + PAYLOAD_SIZE, TRLR_SIZE);
+
+    // A short frame, within a single burst buffer, scattered
+    vburst_iov_t short_iov[2] = {{trlr, TRLR_SIZE}, {hdr, HDR_SIZE}};
+
+    cosim.transBurstRead((uint32_t)0x8000, short_iov, 2);
+
+    error |= compare("short frame trailer segment", trlr, frame, TRLR_SIZE);
+    error |= compare("short frame header segment",  hdr,  frame + TRLR_SIZE, HDR_SIZE);
+
+    // Flag to the simulation we're finished, after 10 more iterations
+    cosim.tick(10, true, error);
+
+    // If ever got this far then sleep forever
+    SLEEPFOREVER;
+}
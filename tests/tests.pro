@@ -17,6 +17,8 @@
 #
 #  Revision History:
 #    Date      Version    Description
+#    10/2026   ????.??    Added queue, batch, future, memview, cache, sgburst, irqqueue
+#                         and replay tests
 #     9/2022   2023.01    Initial version
 #
 #
@@ -43,6 +45,30 @@ simulate   TbAb_CoSim  [CoSim]
 MkVproc    $::osvvm::OsvvmCoSimDirectory  tests/usercode_burst
 simulate   TbAb_CoSim  [CoSim]
 
+MkVproc    $::osvvm::OsvvmCoSimDirectory  tests/queue
+simulate   TbAb_CoSim  [CoSim]
+
+MkVproc    $::osvvm::OsvvmCoSimDirectory  tests/batch
+simulate   TbAb_CoSim  [CoSim]
+
+MkVproc    $::osvvm::OsvvmCoSimDirectory  tests/future
+simulate   TbAb_CoSim  [CoSim]
+
+MkVproc    $::osvvm::OsvvmCoSimDirectory  tests/memview
+simulate   TbAb_CoSim  [CoSim]
+
+MkVproc    $::osvvm::OsvvmCoSimDirectory  tests/cache
+simulate   TbAb_CoSim  [CoSim]
+
+MkVproc    $::osvvm::OsvvmCoSimDirectory  tests/sgburst
+simulate   TbAb_CoSim  [CoSim]
+
+MkVproc    $::osvvm::OsvvmCoSimDirectory  tests/irqqueue
+simulate   TbAb_CoSim  [CoSim]
+
+MkVproc    $::osvvm::OsvvmCoSimDirectory  tests/replay
+simulate   TbAb_CoSim  [CoSim]
+
 MkVproc    $::osvvm::OsvvmCoSimDirectory  tests/iss rv32
 simulate   TbAb_CoSim  [CoSim]
 